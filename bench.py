@@ -0,0 +1,109 @@
+# Command route benchmark: sends the same request mix to a pad and reports
+# per-route latency and overall throughput, so boards (and web servers) can
+# be compared on the same numbers. Works against the native build too.
+#
+#   python bench.py 192.168.4.1
+#   python bench.py localhost:8080 --requests 2000 --connections 2
+#
+# The mix only uses commands that leave a SAFE pad as it was; the pad must
+# be SAFE to start. The device's own view (route.* lines from /metrics,
+# receive to reply) is printed after the client-side numbers.
+
+import argparse
+import http.client
+import random
+import threading
+import time
+
+# (path, weight); nudges go both ways so the clamps end where they started
+MIX = [
+    ("/clamps/nudge?clamp1=1&clamp2=1", 4),
+    ("/clamps/nudge?clamp1=-1&clamp2=-1", 4),
+    ("/disarm", 2),
+    ("/hold", 2),
+    ("/recycle", 2),
+    ("/sequence", 1),
+    ("/clamps/calibration", 1),
+]
+
+
+def request_mix(count, seed):
+    rng = random.Random(seed)
+    paths = [path for path, _ in MIX]
+    weights = [weight for _, weight in MIX]
+    return rng.choices(paths, weights, k=count)
+
+
+def get(conn, path):
+    conn.request("GET", path)
+    response = conn.getresponse()
+    return response.status, response.read().decode(errors="replace")
+
+
+def worker(host, timeout, paths, results):
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    for path in paths:
+        start = time.perf_counter()
+        try:
+            status, _ = get(conn, path)
+        except (OSError, http.client.HTTPException):
+            status = 0
+            conn.close()
+            conn = http.client.HTTPConnection(host, timeout=timeout)
+        results.append((path.split("?")[0], status, time.perf_counter() - start))
+    conn.close()
+
+
+def percentile(sorted_values, pct):
+    index = min(len(sorted_values) - 1, max(0, round(pct / 100 * len(sorted_values)) - 1))
+    return sorted_values[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the pad command routes")
+    parser.add_argument("host", help="pad address, host[:port]")
+    parser.add_argument("--requests", type=int, default=500)
+    parser.add_argument("--connections", type=int, default=1, help="keep-alive connections in parallel")
+    parser.add_argument("--seed", type=int, default=1, help="seed for the request mix")
+    parser.add_argument("--timeout", type=float, default=5.0)
+    args = parser.parse_args()
+
+    conn = http.client.HTTPConnection(args.host, timeout=args.timeout)
+    _, sequence = get(conn, "/sequence")
+    if "phase=SAFE" not in sequence:
+        raise SystemExit(f"Pad is not SAFE ({sequence.strip()}); refusing to benchmark")
+    get(conn, "/metrics?reset=1")
+    conn.close()
+
+    paths = request_mix(args.requests, args.seed)
+    results = []
+    threads = [threading.Thread(target=worker, args=(args.host, args.timeout, paths[i::args.connections], results))
+               for i in range(args.connections)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter() - start
+
+    print(f"{len(results)} requests over {args.connections} connection(s) in {elapsed:.2f} s: "
+          f"{len(results) / elapsed:.1f} req/s")
+    print(f"{'route':<22}{'count':>7}{'errors':>8}{'p50 ms':>9}{'p90 ms':>9}{'p99 ms':>9}{'max ms':>9}")
+    for route in sorted({route for route, _, _ in results}):
+        samples = [r for r in results if r[0] == route]
+        times = sorted(seconds * 1000 for _, _, seconds in samples)
+        errors = sum(1 for _, status, _ in samples if status == 0 or status >= 500)
+        print(f"{route:<22}{len(samples):>7}{errors:>8}{percentile(times, 50):>9.2f}"
+              f"{percentile(times, 90):>9.2f}{percentile(times, 99):>9.2f}{times[-1]:>9.2f}")
+
+    conn = http.client.HTTPConnection(args.host, timeout=args.timeout)
+    _, metrics = get(conn, "/metrics")
+    conn.close()
+    print("\nOn the pad, receive to reply (us):")
+    for line in metrics.splitlines():
+        if line.startswith("route."):
+            print("  " + line)
+
+
+if __name__ == "__main__":
+    main()
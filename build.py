@@ -1,7 +1,19 @@
-import os
+import gzip
+import hashlib
 
-html = str(open("data/index.html").read())
+html = open("data/index.html", "rb").read()
 
-with open("include/html.h", "w") as f:
-    f.write(f'const char PROGMEM index_html[] = R"indexhtml({html})indexhtml";')
+# mtime=0 keeps the output (and the ETag) identical across rebuilds
+compressed = gzip.compress(html, compresslevel=9, mtime=0)
+etag = hashlib.sha1(html).hexdigest()[:16]
 
+with open("include/html.h", "w") as f:
+    f.write("// Generated by build.py from data/index.html. Do not edit.\n")
+    f.write(f"// {len(html)} bytes, {len(compressed)} bytes gzipped\n")
+    f.write("#ifndef HTML_H\n#define HTML_H\n\n")
+    f.write(f'const char index_html_etag[] = "\\"{etag}\\"";\n')
+    f.write(f"const size_t index_html_gz_len = {len(compressed)};\n")
+    f.write("const uint8_t PROGMEM index_html_gz[] = {\n")
+    for i in range(0, len(compressed), 16):
+        f.write("    " + ", ".join(f"0x{b:02x}" for b in compressed[i:i + 16]) + ",\n")
+    f.write("};\n\n#endif\n")
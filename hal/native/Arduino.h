@@ -0,0 +1,309 @@
+// NATIVE ARDUINO HAL
+//
+// Minimal host implementation of the Arduino core used by the launch pad
+// firmware, so that the headers in include/ compile and run on Linux.
+// Pin writes, tones and time are simulated; state can be inspected and
+// controlled through the NativeHAL namespace.
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+// Board LEDs (numbered like the NINA-driven RGB LED on the Nano RP2040 Connect)
+#define LED_BUILTIN 13
+#define LEDR 25
+#define LEDG 26
+#define LEDB 27
+
+// Analog inputs (numbered like the Nano headers)
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+
+// --- PROGMEM ---
+// Flash and RAM share one address space on the host.
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+using std::min;
+using std::max;
+
+template <typename T, typename L, typename H>
+T constrain(T x, L low, H high) {
+    return x < (T)low ? (T)low : (x > (T)high ? (T)high : x);
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// --- Simulator State ---
+namespace NativeHAL {
+    const int NUM_PINS = 64;
+
+    struct PinState {
+        uint8_t mode = INPUT;
+        int value = LOW;          // Last digital or analog value written
+        int analogIn = 0;         // Value returned by analogRead()
+        std::vector<uint16_t> samples; // Recorded stream, one value per analogRead()
+        size_t nextSample = 0;
+        unsigned int toneFreq = 0;
+        uint32_t writes = 0;      // digitalWrite/analogWrite calls on this pin
+    };
+
+    inline PinState pins[NUM_PINS];
+
+    // When virtualClock is set, time only moves through delay() and advance().
+    inline bool virtualClock = false;
+    inline uint64_t virtualMicros = 0;
+    inline const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+    // Added to every WiFiServer port so port 80 can be bound without root.
+    inline uint16_t portOffset = 8000;
+
+    // Mirror Serial output to stdout.
+    inline bool serialEcho = true;
+
+    inline uint64_t nowMicros() {
+        if (virtualClock) return virtualMicros;
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - bootTime).count();
+    }
+
+    inline void advance(uint64_t us) {
+        if (virtualClock) {
+            virtualMicros += us;
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::microseconds(us));
+        }
+    }
+
+    inline PinState* pin(int p) {
+        return (p >= 0 && p < NUM_PINS) ? &pins[p] : nullptr;
+    }
+}
+
+// --- Time ---
+inline unsigned long millis() { return (unsigned long)(NativeHAL::nowMicros() / 1000); }
+inline unsigned long micros() { return (unsigned long)NativeHAL::nowMicros(); }
+inline void delay(unsigned long ms) { NativeHAL::advance((uint64_t)ms * 1000); }
+inline void delayMicroseconds(unsigned int us) { NativeHAL::advance(us); }
+inline void yield() {}
+
+// --- GPIO ---
+inline void pinMode(int pin, int mode) {
+    if (NativeHAL::PinState* p = NativeHAL::pin(pin)) p->mode = mode;
+}
+
+inline void digitalWrite(int pin, int value) {
+    if (NativeHAL::PinState* p = NativeHAL::pin(pin)) {
+        p->value = value ? HIGH : LOW;
+        p->writes++;
+    }
+}
+
+inline int digitalRead(int pin) {
+    NativeHAL::PinState* p = NativeHAL::pin(pin);
+    return p ? p->value : LOW;
+}
+
+inline void analogWrite(int pin, int value) {
+    if (NativeHAL::PinState* p = NativeHAL::pin(pin)) {
+        p->value = value;
+        p->writes++;
+    }
+}
+
+// Plays back the pin's recorded samples, if any, then holds the last one.
+inline int analogRead(int pin) {
+    NativeHAL::PinState* p = NativeHAL::pin(pin);
+    if (!p) return 0;
+    if (p->nextSample < p->samples.size()) {
+        p->analogIn = p->samples[p->nextSample++];
+    }
+    return p->analogIn;
+}
+
+inline void analogReadResolution(int) {}
+
+// --- Tone ---
+// Durations are not simulated; the tone stays on until noTone().
+inline void tone(int pin, unsigned int frequency, unsigned long duration = 0) {
+    (void)duration;
+    if (NativeHAL::PinState* p = NativeHAL::pin(pin)) p->toneFreq = frequency;
+}
+
+inline void noTone(int pin) {
+    if (NativeHAL::PinState* p = NativeHAL::pin(pin)) p->toneFreq = 0;
+}
+
+// --- String ---
+class String {
+public:
+    String(const char* s = "") : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned int v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+    String(double v, int decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        _s = buf;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return atof(_s.c_str()); }
+    int indexOf(char c) const {
+        size_t i = _s.find(c);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+
+    String& operator+=(const String& o) { _s += o._s; return *this; }
+    bool operator==(const String& o) const { return _s == o._s; }
+    bool operator!=(const String& o) const { return _s != o._s; }
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+
+private:
+    std::string _s;
+};
+
+// --- Print / Stream ---
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) {
+        return str ? write((const uint8_t*)str, strlen(str)) : 0;
+    }
+    virtual void flush() {}
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(const __FlashStringHelper* s) { return write(reinterpret_cast<const char*>(s)); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(const Printable& p) { return p.printTo(*this); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print((long long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long long)v, base); }
+    size_t print(long v, int base = DEC) { return print((long long)v, base); }
+    size_t print(unsigned long v, int base = DEC) { return print((unsigned long long)v, base); }
+    size_t print(long long v, int base = DEC) {
+        if (base == DEC) return printf("%lld", v);
+        return print((unsigned long long)v, base);
+    }
+    size_t print(unsigned long long v, int base = DEC) {
+        if (base == HEX) return printf("%llX", v);
+        if (base == BIN) {
+            char buf[65];
+            int i = 64;
+            buf[i] = '\0';
+            do { buf[--i] = '0' + (v & 1); v >>= 1; } while (v);
+            return write(buf + i);
+        }
+        return printf("%llu", v);
+    }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    template <typename T>
+    size_t println(const T& v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+    __attribute__((format(printf, 2, 3)))
+    size_t printf(const char* format, ...) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0) return 0;
+        if ((size_t)len >= sizeof(buf)) len = sizeof(buf) - 1;
+        return write((const uint8_t*)buf, len);
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() const { return true; }
+
+    size_t write(uint8_t c) override {
+        if (NativeHAL::serialEcho) fputc(c, stdout);
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (NativeHAL::serialEcho) fwrite(buffer, 1, size, stdout);
+        return size;
+    }
+    using Print::write;
+    void flush() override { fflush(stdout); }
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+
+inline HardwareSerial Serial;
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,51 @@
+// NATIVE SERVO
+// Records the commanded angle instead of generating a PWM signal.
+
+#ifndef NATIVE_SERVO_H
+#define NATIVE_SERVO_H
+#include <Arduino.h>
+
+class Servo {
+public:
+    uint8_t attach(int pin) {
+        this->pin = pin;
+        return 0;
+    }
+
+    uint8_t attach(int pin, int, int) {
+        return attach(pin);
+    }
+
+    void detach() {
+        this->pin = -1;
+    }
+
+    bool attached() {
+        return this->pin >= 0;
+    }
+
+    void write(int angle) {
+        this->angle = constrain(angle, 0, 180);
+        this->writes++;
+    }
+
+    void writeMicroseconds(int us) {
+        write(map(constrain(us, 544, 2400), 544, 2400, 0, 180));
+    }
+
+    int read() {
+        return this->angle;
+    }
+
+    // Simulator inspection
+    uint32_t writeCount() const {
+        return this->writes;
+    }
+
+private:
+    int pin = -1;
+    int angle = 90;
+    uint32_t writes = 0;
+};
+
+#endif
@@ -0,0 +1,246 @@
+// NATIVE WIFININA
+//
+// WiFiServer/WiFiClient backed by non-blocking POSIX TCP sockets, so the
+// firmware's web server can be reached from a browser or curl on the host.
+// Every server port is shifted by NativeHAL::portOffset (80 -> 8080 by default).
+
+#ifndef NATIVE_WIFININA_H
+#define NATIVE_WIFININA_H
+
+#include <Arduino.h>
+#include <memory>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+enum wl_status_t {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+    WL_AP_LISTENING,
+    WL_AP_CONNECTED,
+    WL_AP_FAILED
+};
+
+namespace NativeHAL {
+    // Socket-level counters, the host analogue of NINA SPI transactions.
+    inline uint32_t netWriteCalls = 0;
+    inline uint32_t netBytesWritten = 0;
+    inline uint32_t netReadCalls = 0;
+}
+
+class IPAddress : public Printable {
+public:
+    IPAddress() : IPAddress(0, 0, 0, 0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+        _bytes[0] = a;
+        _bytes[1] = b;
+        _bytes[2] = c;
+        _bytes[3] = d;
+    }
+
+    uint8_t operator[](int i) const { return _bytes[i]; }
+
+    size_t printTo(Print& p) const override {
+        return p.printf("%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+    }
+
+private:
+    uint8_t _bytes[4];
+};
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int fd) : _sock(std::make_shared<Socket>(fd)) {}
+
+    uint8_t connected() {
+        if (!_sock || _sock->fd < 0) return 0;
+        uint8_t c;
+        ssize_t n = recv(_sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+        if (n > 0) return 1;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 1;
+        return 0;
+    }
+
+    int available() override {
+        if (!_sock || _sock->fd < 0) return 0;
+        int n = 0;
+        if (ioctl(_sock->fd, FIONREAD, &n) < 0) return 0;
+        return n;
+    }
+
+    int read() override {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+
+    int read(uint8_t* buf, size_t size) {
+        if (!_sock || _sock->fd < 0) return -1;
+        NativeHAL::netReadCalls++;
+        ssize_t n = recv(_sock->fd, buf, size, MSG_DONTWAIT);
+        return n > 0 ? (int)n : -1;
+    }
+
+    int peek() override {
+        if (!_sock || _sock->fd < 0) return -1;
+        uint8_t c;
+        return recv(_sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+    }
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+
+    // Blocks until the whole buffer is queued, like the NINA firmware does.
+    size_t write(const uint8_t* buf, size_t size) override {
+        if (!_sock || _sock->fd < 0) return 0;
+        NativeHAL::netWriteCalls++;
+        size_t sent = 0;
+        while (sent < size) {
+            ssize_t n = send(_sock->fd, buf + sent, size - sent, MSG_NOSIGNAL);
+            if (n > 0) {
+                sent += n;
+            }
+            else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                pollfd pfd = { _sock->fd, POLLOUT, 0 };
+                poll(&pfd, 1, 100);
+            }
+            else {
+                break;
+            }
+        }
+        NativeHAL::netBytesWritten += sent;
+        return sent;
+    }
+    using Print::write;
+
+    void flush() override {}
+
+    void stop() {
+        if (_sock && _sock->fd >= 0) {
+            close(_sock->fd);
+            _sock->fd = -1;
+        }
+    }
+
+    IPAddress remoteIP() {
+        sockaddr_in addr;
+        socklen_t len = sizeof(addr);
+        if (!_sock || _sock->fd < 0 || getpeername(_sock->fd, (sockaddr*)&addr, &len) < 0) {
+            return IPAddress();
+        }
+        uint32_t ip = ntohl(addr.sin_addr.s_addr);
+        return IPAddress(ip >> 24, ip >> 16, ip >> 8, ip);
+    }
+
+    operator bool() const {
+        return _sock && _sock->fd >= 0;
+    }
+
+    bool operator==(const WiFiClient& other) const {
+        return _sock == other._sock;
+    }
+
+    bool operator!=(const WiFiClient& other) const {
+        return _sock != other._sock;
+    }
+
+private:
+    // Copies of a WiFiClient share one socket, as they share one NINA socket number.
+    struct Socket {
+        int fd;
+        explicit Socket(int fd) : fd(fd) {}
+        ~Socket() {
+            if (fd >= 0) close(fd);
+        }
+    };
+    std::shared_ptr<Socket> _sock;
+};
+
+class WiFiServer {
+public:
+    WiFiServer(uint16_t port) : _port(port) {}
+
+    ~WiFiServer() {
+        if (_fd >= 0) close(_fd);
+    }
+
+    void begin() {
+        _fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+        if (_fd < 0) return;
+        int one = 1;
+        setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(_port + NativeHAL::portOffset);
+        if (bind(_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(_fd, 8) < 0) {
+            perror("WiFiServer");
+            close(_fd);
+            _fd = -1;
+        }
+    }
+
+    // Returns a newly accepted connection, or an invalid client if none is pending.
+    WiFiClient available() {
+        if (_fd < 0) return WiFiClient();
+        int fd = accept4(_fd, nullptr, nullptr, SOCK_NONBLOCK);
+        if (fd < 0) return WiFiClient();
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        return WiFiClient(fd);
+    }
+
+    uint16_t port() const {
+        return _port + NativeHAL::portOffset;
+    }
+
+private:
+    uint16_t _port;
+    int _fd = -1;
+};
+
+class WiFiClass {
+public:
+    uint8_t beginAP(const char*, const char*) {
+        _status = WL_AP_LISTENING;
+        return _status;
+    }
+
+    uint8_t begin(const char*, const char*) {
+        _status = WL_CONNECTED;
+        return _status;
+    }
+
+    void config(IPAddress ip, IPAddress, IPAddress) {
+        _ip = ip;
+    }
+
+    IPAddress localIP() {
+        return _ip;
+    }
+
+    uint8_t status() {
+        return _status;
+    }
+
+private:
+    uint8_t _status = WL_IDLE_STATUS;
+    IPAddress _ip = IPAddress(127, 0, 0, 1);
+};
+
+inline WiFiClass WiFi;
+
+#endif // NATIVE_WIFININA_H
@@ -0,0 +1,126 @@
+// NATIVE WIFIUDP
+//
+// WiFiUDP backed by a non-blocking POSIX UDP socket. Like WiFiServer, the
+// local port is shifted by NativeHAL::portOffset.
+
+#ifndef NATIVE_WIFIUDP_H
+#define NATIVE_WIFIUDP_H
+
+#include <WiFiNINA.h>
+
+#define NATIVE_UDP_MAX_PACKET 1472
+
+class WiFiUDP : public Stream {
+public:
+    ~WiFiUDP() {
+        stop();
+    }
+
+    uint8_t begin(uint16_t port) {
+        stop();
+        _fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+        if (_fd < 0) return 0;
+        int one = 1;
+        setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port + NativeHAL::portOffset);
+        if (bind(_fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            perror("WiFiUDP");
+            stop();
+            return 0;
+        }
+        return 1;
+    }
+
+    void stop() {
+        if (_fd >= 0) {
+            close(_fd);
+            _fd = -1;
+        }
+    }
+
+    // Receives the next datagram; its size, or 0 if none is waiting.
+    int parsePacket() {
+        _rxLen = _rxPos = 0;
+        if (_fd < 0) return 0;
+        socklen_t len = sizeof(_remote);
+        NativeHAL::netReadCalls++;
+        ssize_t n = recvfrom(_fd, _rx, sizeof(_rx), MSG_DONTWAIT, (sockaddr*)&_remote, &len);
+        if (n <= 0) return 0;
+        _rxLen = n;
+        return n;
+    }
+
+    int available() override {
+        return _rxLen - _rxPos;
+    }
+
+    int read() override {
+        return _rxPos < _rxLen ? _rx[_rxPos++] : -1;
+    }
+
+    int read(uint8_t* buf, size_t size) {
+        size_t n = min(size, _rxLen - _rxPos);
+        memcpy(buf, _rx + _rxPos, n);
+        _rxPos += n;
+        return n;
+    }
+
+    int peek() override {
+        return _rxPos < _rxLen ? _rx[_rxPos] : -1;
+    }
+
+    IPAddress remoteIP() {
+        uint32_t ip = ntohl(_remote.sin_addr.s_addr);
+        return IPAddress(ip >> 24, ip >> 16, ip >> 8, ip);
+    }
+
+    uint16_t remotePort() {
+        return ntohs(_remote.sin_port);
+    }
+
+    int beginPacket(IPAddress ip, uint16_t port) {
+        _to = {};
+        _to.sin_family = AF_INET;
+        _to.sin_addr.s_addr = htonl((uint32_t)ip[0] << 24 | (uint32_t)ip[1] << 16 | (uint32_t)ip[2] << 8 | ip[3]);
+        _to.sin_port = htons(port);
+        _txLen = 0;
+        return 1;
+    }
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* buf, size_t size) override {
+        size_t n = min(size, sizeof(_tx) - _txLen);
+        memcpy(_tx + _txLen, buf, n);
+        _txLen += n;
+        return n;
+    }
+    using Print::write;
+
+    int endPacket() {
+        if (_fd < 0) return 0;
+        NativeHAL::netWriteCalls++;
+        ssize_t n = sendto(_fd, _tx, _txLen, 0, (sockaddr*)&_to, sizeof(_to));
+        if (n > 0) NativeHAL::netBytesWritten += n;
+        return n == (ssize_t)_txLen;
+    }
+
+    void flush() override {}
+
+private:
+    int _fd = -1;
+    uint8_t _rx[NATIVE_UDP_MAX_PACKET];
+    size_t _rxLen = 0;
+    size_t _rxPos = 0;
+    uint8_t _tx[NATIVE_UDP_MAX_PACKET];
+    size_t _txLen = 0;
+    sockaddr_in _remote = {};
+    sockaddr_in _to = {};
+};
+
+#endif // NATIVE_WIFIUDP_H
@@ -0,0 +1,5 @@
+// PROGMEM helpers live in the native Arduino.h; flash is ordinary memory on the host.
+#ifndef NATIVE_AVR_PGMSPACE_H
+#define NATIVE_AVR_PGMSPACE_H
+#include <Arduino.h>
+#endif
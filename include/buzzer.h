@@ -1,59 +1,198 @@
+// BUZZER CONTROLLER
+
+#ifndef BUZZER_H
+#define BUZZER_H
 #include <Arduino.h>
+#include <outputs.h>
+#include <pins.h>
+
+// One step of a melody. The tone sounds for `duration` ms, then the buzzer is
+// silent for `gap` ms; this repeats `repeat` times before the next note.
+struct BuzzerNote {
+    uint16_t freq;      // Hz, 0 = rest
+    uint16_t duration;  // ms
+    uint8_t repeat;
+    uint16_t gap;       // ms
+};
+
+// Melodies (note tables live in flash)
+const BuzzerNote STARTUP_NOTES[] = {
+    { 415, 215, 1, 35 },  // G#4
+    { 523, 215, 1, 35 },  // C5
+    { 622, 215, 1, 35 },  // D#5
+    { 831, 215, 1, 35 },  // G#5
+};
+
+const BuzzerNote SHUTDOWN_NOTES[] = {
+    { 831, 215, 1, 35 },  // G#5
+    { 622, 215, 1, 35 },  // D#5
+    { 523, 215, 1, 35 },  // C5
+    { 415, 215, 1, 35 },  // G#4
+};
+
+const BuzzerNote ABORT_NOTES[] = {
+    { 415, 250, 6, 250 },
+};
+
+const BuzzerNote LOCATOR_NOTES[] = {
+    { 415, 1000, 1, 1000 },
+};
+
+const BuzzerNote COUNTDOWN_TICK_NOTES[] = {
+    { 880, 100, 1, 0 },
+};
+
+const BuzzerNote IGNITION_NOTES[] = {
+    { 1760, 1000, 1, 0 },
+};
+
+#define BUZZER_MELODY(notes) notes, (uint8_t)(sizeof(notes) / sizeof(notes[0]))
+
+// Plays note tables from update(), which must be called every loop iteration.
+// Nothing here blocks; each update() is a millis() compare and at most one
+// tone()/noTone() call, through the output shadow.
+class BuzzerSequencer {
+public:
+    BuzzerSequencer(int pin) {
+        this->pin = pin;
+    }
+
+    void play(const BuzzerNote* notes, uint8_t count, bool loop = false) {
+        if (!notes || count == 0) {
+            stop();
+            return;
+        }
+        this->notes = notes;
+        this->count = count;
+        this->loop = loop;
+        this->index = 0;
+        this->repeatsLeft = notes[0].repeat;
+        startTone(millis());
+    }
+
+    void stop() {
+        this->notes = nullptr;
+        outputs.stopTone(this->pin);
+    }
+
+    bool isPlaying() {
+        return this->notes != nullptr;
+    }
+
+    void update() {
+        if (!this->notes) {
+            return;
+        }
+        unsigned long now = millis();
+        if (now - this->phaseStart < this->phaseLength) {
+            return;
+        }
+
+        const BuzzerNote& note = this->notes[this->index];
+        if (this->inTone && note.gap > 0) {
+            outputs.stopTone(this->pin);
+            this->inTone = false;
+            this->phaseStart = now;
+            this->phaseLength = note.gap;
+            return;
+        }
+
+        if (this->repeatsLeft > 1) {
+            this->repeatsLeft--;
+        }
+        else if (this->index + 1 < this->count) {
+            this->index++;
+            this->repeatsLeft = this->notes[this->index].repeat;
+        }
+        else if (this->loop) {
+            this->index = 0;
+            this->repeatsLeft = this->notes[0].repeat;
+        }
+        else {
+            stop();
+            return;
+        }
+        startTone(now);
+    }
+
+private:
+    int pin;
+    const BuzzerNote* notes = nullptr;
+    uint8_t count = 0;
+    uint8_t index = 0;
+    uint8_t repeatsLeft = 0;
+    bool loop = false;
+    bool inTone = false;
+    unsigned long phaseStart = 0;
+    unsigned long phaseLength = 0;
+
+    void startTone(unsigned long now) {
+        const BuzzerNote& note = this->notes[this->index];
+        if (note.freq > 0) {
+            outputs.writeTone(this->pin, note.freq);
+        }
+        else {
+            outputs.stopTone(this->pin);
+        }
+        this->inTone = true;
+        this->phaseStart = now;
+        this->phaseLength = note.duration;
+    }
+};
+
+BuzzerSequencer buzzer(BUZZER_PIN);
 
 void playConstantTone(int freq, int duration) {
-    noTone(BUZZER_PIN);
-    tone(BUZZER_PIN, freq, duration);
+    buzzer.stop();
+    outputs.writeTone(BUZZER_PIN, freq, duration);
 }
 
 void playToneForever(int freq) {
-    noTone(BUZZER_PIN);
-    tone(BUZZER_PIN, freq);
+    buzzer.stop();
+    outputs.writeTone(BUZZER_PIN, freq);
 }
 
 void stopTone() {
-    noTone(BUZZER_PIN);
+    buzzer.stop();
 }
 
-void beepTone(int freq) {
-    if ((millis() / 500) == 1) {
-        tone(BUZZER_PIN, freq);
+// Square-wave beep with a 50% duty cycle; call every loop iteration.
+void beepTone(int freq, int delay) {
+    if (((millis() / delay) & 1) == 1) {
+        outputs.writeTone(BUZZER_PIN, freq);
     }
     else {
-        noTone(BUZZER_PIN);
+        outputs.stopTone(BUZZER_PIN);
     }
-
 }
 
-void beepTone(int freq, int delay) {
-    if ((millis() / delay) == 1) {
-        tone(BUZZER_PIN, freq);
-    }
-    else {
-        noTone(BUZZER_PIN);
-    }
+void beepTone(int freq) {
+    beepTone(freq, 500);
 }
 
+// The play*Sound() functions start a melody and return immediately.
 void playStartupSound() {
-    int notes[4] = { 415, 523, 622, 831 }; // G#4 C5 D#5 G#5
-    for (int i = 0; i < 4; i++) {
-        tone(BUZZER_PIN, notes[i], 215);
-        delay(250);
-    }
-    noTone(BUZZER_PIN);
+    buzzer.play(BUZZER_MELODY(STARTUP_NOTES));
 }
 
 void playAbortSound() {
-    beepTone(415, 250);
+    buzzer.play(BUZZER_MELODY(ABORT_NOTES));
 }
 
 void playShutdownSound() {
-    int notes[4] = { 813, 622, 523, 415 }; // G#5 D#5 C5 G#4
-    for (int i = 0; i < 4; i++) {
-        tone(BUZZER_PIN, notes[i], 215);
-        delay(250);
-    }
+    buzzer.play(BUZZER_MELODY(SHUTDOWN_NOTES));
 }
 
 void playLocatorSound() {
-    beepTone(415, 1000);
-}
\ No newline at end of file
+    buzzer.play(BUZZER_MELODY(LOCATOR_NOTES), true);
+}
+
+void playCountdownTick() {
+    buzzer.play(BUZZER_MELODY(COUNTDOWN_TICK_NOTES));
+}
+
+void playIgnitionSound() {
+    buzzer.play(BUZZER_MELODY(IGNITION_NOTES));
+}
+
+#endif
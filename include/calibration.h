@@ -0,0 +1,223 @@
+// CALIBRATION STORE
+//
+// Keeps the clamp calibration across reboots:
+//   ESP32:  a small file on LittleFS (board_build.filesystem = littlefs)
+//   RP2040: the last sector of the program flash, through mbed::FlashIAP
+//   native: a file in the working directory
+//
+// Records carry a magic, a version and a CRC, so a blank or torn record is
+// ignored and the defaults stay. save() only writes when the calibration
+// differs from what is stored. On RP2040 each save also goes to the next free
+// 256-byte slot of the sector, so a 4 KB sector is erased once per 16 saves
+// rather than on every one; loading is a scan of memory-mapped flash.
+// Core 1 runs from that flash too, so it is parked in RAM (multicore
+// lockout) for each erase and program; it must have called
+// multicore_lockout_victim_init(), and a save fails if it does not answer.
+
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+#include <Arduino.h>
+#include <clamps.h>
+#if USE_ESP32
+#include <LittleFS.h>
+#elif USE_RP2040
+#include <mbed.h>
+#include "pico/multicore.h"
+#endif
+#include <stdio.h>
+
+#define CALIBRATION_MAGIC 0x4C43 // "CL"
+#define CALIBRATION_VERSION 1
+#define CALIBRATION_FILE "/clamps.bin"
+#define CALIBRATION_LOCKOUT_US 10000    // How long a save waits for core 1 to park
+#define CALIBRATION_FORMAT_SIZE 176     // Fits the longest format() line, 64-bit longs too
+
+struct CalibrationRecord {
+    uint16_t magic;
+    uint16_t version;
+    ClampCalibration calibration;
+    uint32_t crc;
+};
+
+inline uint32_t calibrationCrc(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+inline uint32_t calibrationRecordCrc(const CalibrationRecord& record) {
+    return calibrationCrc((const uint8_t*)&record, offsetof(CalibrationRecord, crc));
+}
+
+inline bool calibrationRecordValid(const CalibrationRecord& record) {
+    return record.magic == CALIBRATION_MAGIC && record.version == CALIBRATION_VERSION &&
+        record.crc == calibrationRecordCrc(record);
+}
+
+class CalibrationStore {
+public:
+    uint32_t saves = 0;         // Writes that reached flash
+    uint32_t skipped = 0;       // save() calls with nothing changed
+    uint32_t loadMicros = 0;    // How long begin() took
+
+    // Loads the stored calibration into `calibration`; false (and `calibration`
+    // untouched) if there is none.
+    bool begin(ClampCalibration& calibration) {
+        unsigned long start = micros();
+        CalibrationRecord record;
+        this->loaded = readRecord(record);
+        if (this->loaded) {
+            calibration = record.calibration;
+            this->stored = record.calibration;
+        }
+        this->loadMicros = micros() - start;
+        return this->loaded;
+    }
+
+    // Writes `calibration` unless it is already what is stored.
+    bool save(const ClampCalibration& calibration) {
+        if (this->loaded && calibration == this->stored) {
+            this->skipped++;
+            return true;
+        }
+        CalibrationRecord record;
+        memset(&record, 0, sizeof(record));
+        record.magic = CALIBRATION_MAGIC;
+        record.version = CALIBRATION_VERSION;
+        record.calibration = calibration;
+        record.crc = calibrationRecordCrc(record);
+        if (!writeRecord(record)) {
+            Serial.println(F("ERROR: Could not save clamp calibration."));
+            return false;
+        }
+        this->stored = calibration;
+        this->loaded = true;
+        this->saves++;
+        return true;
+    }
+
+    // "open=a,b close=c,d min=a,b max=c,d saves=.. skipped=.. load_us=.."
+    // Never truncated in a CALIBRATION_FORMAT_SIZE buffer.
+    int format(const ClampCalibration& cal, char* buffer, size_t size) {
+        return snprintf(buffer, size,
+            "open=%d,%d close=%d,%d min=%d,%d max=%d,%d saves=%lu skipped=%lu load_us=%lu\n",
+            cal.clamp1Open, cal.clamp2Open, cal.clamp1Close, cal.clamp2Close,
+            cal.clamp1Min, cal.clamp2Min, cal.clamp1Max, cal.clamp2Max,
+            (unsigned long)this->saves, (unsigned long)this->skipped, (unsigned long)this->loadMicros);
+    }
+
+private:
+    ClampCalibration stored;
+    bool loaded = false;
+
+#if USE_ESP32
+    bool mounted = false;
+
+    bool mount() {
+        if (!this->mounted) {
+            this->mounted = LittleFS.begin(true); // Formats a blank partition
+        }
+        return this->mounted;
+    }
+
+    bool readRecord(CalibrationRecord& record) {
+        if (!mount()) return false;
+        File file = LittleFS.open(CALIBRATION_FILE, "r");
+        if (!file) return false;
+        bool ok = file.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+        file.close();
+        return ok && calibrationRecordValid(record);
+    }
+
+    bool writeRecord(const CalibrationRecord& record) {
+        if (!mount()) return false;
+        File file = LittleFS.open(CALIBRATION_FILE, "w");
+        if (!file) return false;
+        bool ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+        file.close();
+        return ok;
+    }
+
+#elif USE_RP2040
+    // Records are padded to a whole flash page so each can be programmed alone.
+    static const uint32_t SLOT_SIZE = 256;
+    mbed::FlashIAP flash;
+    uint32_t sectorAddress = 0;
+    uint32_t sectorSize = 0;
+    int nextSlot = 0;
+
+    bool open() {
+        if (this->sectorSize == 0) {
+            if (this->flash.init() != 0) return false;
+            uint32_t end = this->flash.get_flash_start() + this->flash.get_flash_size();
+            this->sectorSize = this->flash.get_sector_size(end - 1);
+            this->sectorAddress = end - this->sectorSize;
+        }
+        return true;
+    }
+
+    int slots() {
+        return this->sectorSize / SLOT_SIZE;
+    }
+
+    // The newest record is the last valid one before the first blank slot.
+    bool readRecord(CalibrationRecord& record) {
+        if (!open()) return false;
+        bool found = false;
+        this->nextSlot = slots();
+        for (int i = 0; i < slots(); i++) {
+            const CalibrationRecord* slot = (const CalibrationRecord*)(this->sectorAddress + i * SLOT_SIZE);
+            if (slot->magic == 0xFFFF) {
+                this->nextSlot = i;
+                break;
+            }
+            if (calibrationRecordValid(*slot)) {
+                record = *slot;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    bool writeRecord(const CalibrationRecord& record) {
+        if (!open()) return false;
+        uint8_t page[SLOT_SIZE];
+        memset(page, 0xFF, sizeof(page));
+        memcpy(page, &record, sizeof(record));
+        if (!multicore_lockout_start_timeout_us(CALIBRATION_LOCKOUT_US)) return false;
+        bool ok = true;
+        if (this->nextSlot >= slots()) {
+            ok = this->flash.erase(this->sectorAddress, this->sectorSize) == 0;
+            if (ok) this->nextSlot = 0;
+        }
+        ok = ok && this->flash.program(page, this->sectorAddress + this->nextSlot * SLOT_SIZE, SLOT_SIZE) == 0;
+        multicore_lockout_end_timeout_us(CALIBRATION_LOCKOUT_US);
+        if (ok) this->nextSlot++;
+        return ok;
+    }
+
+#else
+    bool readRecord(CalibrationRecord& record) {
+        FILE* file = fopen(CALIBRATION_FILE + 1, "rb");
+        if (!file) return false;
+        bool ok = fread(&record, sizeof(record), 1, file) == 1;
+        fclose(file);
+        return ok && calibrationRecordValid(record);
+    }
+
+    bool writeRecord(const CalibrationRecord& record) {
+        FILE* file = fopen(CALIBRATION_FILE + 1, "wb");
+        if (!file) return false;
+        bool ok = fwrite(&record, sizeof(record), 1, file) == 1;
+        fclose(file);
+        return ok;
+    }
+#endif
+};
+
+#endif
@@ -5,10 +5,40 @@
 #include <Servo.h>
 #endif
 #include <pins.h>
+#include <eventlog.h>
 
 #ifndef CLAMPS_H
 #define CLAMPS_H
-#endif
+
+// Motion profile for openClamps()/closeClamps()/moveTo()
+enum ClampProfile {
+    PROFILE_STEP,       // Jump straight to the target (the old behaviour)
+    PROFILE_TRAPEZOID,  // Constant acceleration, cruise, constant deceleration
+    PROFILE_SCURVE      // Quintic: zero velocity and acceleration at both ends
+};
+
+const float CLAMP_MAX_SPEED = 360.0;    // deg/s
+const float CLAMP_MAX_ACCEL = 3600.0;   // deg/s^2
+
+// Presets and soft travel limits (degrees), persisted by calibration.h
+struct ClampCalibration {
+    int16_t clamp1Open;
+    int16_t clamp2Open;
+    int16_t clamp1Close;
+    int16_t clamp2Close;
+    int16_t clamp1Min;
+    int16_t clamp1Max;
+    int16_t clamp2Min;
+    int16_t clamp2Max;
+
+    bool operator==(const ClampCalibration& other) const {
+        return memcmp(this, &other, sizeof(ClampCalibration)) == 0;
+    }
+
+    bool operator!=(const ClampCalibration& other) const {
+        return !(*this == other);
+    }
+};
 
 struct Vec2D {
     int x;
@@ -42,24 +72,90 @@ public:
     }
 
     void openClamps() {
-        write(clamp1Open, clamp2Open);
-        clamp1Pos = clamp1Open;
-        clamp2Pos = clamp2Open;
+        moveTo(clamp1Open, clamp2Open);
     }
 
     void closeClamps() {
-        write(clamp1Close, clamp2Close);
-        clamp1Pos = clamp1Close;
-        clamp2Pos = clamp2Close;
+        moveTo(clamp1Close, clamp2Close);
     }
 
+    void setProfile(ClampProfile profile, float maxSpeed, float maxAccel) {
+        this->profile = profile;
+        this->maxSpeed = maxSpeed;
+        this->maxAccel = maxAccel;
+    }
+
+    // Starts a move along the current profile; update() carries it out.
+    // Both clamps share one duration, set by the longer travel, so they
+    // arrive together. Returns the move duration in ms.
+    unsigned long moveTo(int clamp1, int clamp2) {
+        clamp1 = constrain(clamp1, clamp1Min, clamp1Max);
+        clamp2 = constrain(clamp2, clamp2Min, clamp2Max);
+        this->from1 = this->pos1;
+        this->from2 = this->pos2;
+        this->to1 = clamp1;
+        this->to2 = clamp2;
+        float distance = max(fabsf(this->to1 - this->from1), fabsf(this->to2 - this->from2));
+        this->moveStart = millis();
+        this->moveDuration = (unsigned long)ceilf(profileDuration(distance) * 1000.0f);
+        this->moving = true;
+        update();
+        return this->moveDuration;
+    }
+
+    // Immediate write; cancels any move in progress.
     void write(int clamp1, int clamp2) {
-        clamp1 = constrain(clamp1, 0, 180);
-        clamp2 = constrain(clamp2, 0, 180);
-        this->clamp1Servo.write(clamp1);
-        this->clamp2Servo.write(clamp2);
-        clamp1Pos = clamp1;
-        clamp2Pos = clamp2;
+        clamp1 = constrain(clamp1, clamp1Min, clamp1Max);
+        clamp2 = constrain(clamp2, clamp2Min, clamp2Max);
+        this->moving = false;
+        this->pos1 = clamp1;
+        this->pos2 = clamp2;
+        writeServos(clamp1, clamp2);
+    }
+
+    // Advances the current move; call every loop iteration.
+    void update() {
+        if (!this->moving) {
+            return;
+        }
+        unsigned long elapsed = millis() - this->moveStart;
+        if (elapsed >= this->moveDuration) {
+            this->moving = false;
+            this->pos1 = this->to1;
+            this->pos2 = this->to2;
+        }
+        else {
+            float fraction = profileFraction((float)elapsed / this->moveDuration);
+            this->pos1 = this->from1 + (this->to1 - this->from1) * fraction;
+            this->pos2 = this->from2 + (this->to2 - this->from2) * fraction;
+        }
+        writeServos(lroundf(this->pos1), lroundf(this->pos2));
+    }
+
+    bool isMoving() {
+        return this->moving;
+    }
+
+    // millis() at which the current (or last) move finishes
+    unsigned long getMoveEnd() {
+        return this->moveStart + this->moveDuration;
+    }
+
+    ClampCalibration getCalibration() {
+        return ClampCalibration{ (int16_t)clamp1Open, (int16_t)clamp2Open, (int16_t)clamp1Close, (int16_t)clamp2Close,
+            (int16_t)clamp1Min, (int16_t)clamp1Max, (int16_t)clamp2Min, (int16_t)clamp2Max };
+    }
+
+    // Limits are sanitised to 0-180 with min <= max; presets are kept inside them.
+    void setCalibration(const ClampCalibration& cal) {
+        clamp1Min = constrain(cal.clamp1Min, 0, 180);
+        clamp1Max = constrain(cal.clamp1Max, clamp1Min, 180);
+        clamp2Min = constrain(cal.clamp2Min, 0, 180);
+        clamp2Max = constrain(cal.clamp2Max, clamp2Min, 180);
+        clamp1Open = constrain(cal.clamp1Open, clamp1Min, clamp1Max);
+        clamp2Open = constrain(cal.clamp2Open, clamp2Min, clamp2Max);
+        clamp1Close = constrain(cal.clamp1Close, clamp1Min, clamp1Max);
+        clamp2Close = constrain(cal.clamp2Close, clamp2Min, clamp2Max);
     }
 
     Vec2D getPos() {
@@ -69,9 +165,7 @@ public:
     void nudge(int clamp1, int clamp2) {
         clamp1 = constrain(clamp1, -1, 1);
         clamp2 = constrain(clamp2, -1, 1);
-        clamp1Pos += clamp1;
-        clamp2Pos += clamp2;
-        write(clamp1Pos, clamp2Pos);
+        write(clamp1Pos + clamp1, clamp2Pos + clamp2);
         
     }
 
@@ -82,10 +176,78 @@ private:
 
     int clamp1Pos = 0;
     int clamp2Pos = 0;
+    int written1 = -1;      // Last angles sent to the servos (-1 = none yet)
+    int written2 = -1;
+
+    ClampProfile profile = PROFILE_TRAPEZOID;
+    float maxSpeed = CLAMP_MAX_SPEED;
+    float maxAccel = CLAMP_MAX_ACCEL;
+    bool moving = false;
+    float pos1 = 0, pos2 = 0;   // Commanded position along the move
+    float from1 = 0, from2 = 0;
+    float to1 = 0, to2 = 0;
+    unsigned long moveStart = 0;
+    unsigned long moveDuration = 0;
 
     int clamp1Open = 90;
     int clamp2Open = 90;
 
     int clamp1Close = 0;
     int clamp2Close = 0;
+
+    int clamp1Min = 0;
+    int clamp1Max = 180;
+    int clamp2Min = 0;
+    int clamp2Max = 180;
+
+    // Shortest time to travel `distance` degrees within maxSpeed and maxAccel
+    float profileDuration(float distance) {
+        if (distance <= 0 || this->profile == PROFILE_STEP) {
+            return 0;
+        }
+        if (this->profile == PROFILE_SCURVE) {
+            // Quintic peaks at 1.875 d/T velocity and 5.7735 d/T^2 acceleration
+            return max(1.875f * distance / this->maxSpeed, sqrtf(5.7735f * distance / this->maxAccel));
+        }
+        float rampDistance = this->maxSpeed * this->maxSpeed / this->maxAccel;
+        if (distance >= rampDistance) {
+            return distance / this->maxSpeed + this->maxSpeed / this->maxAccel;
+        }
+        return 2.0f * sqrtf(distance / this->maxAccel); // Triangle: never reaches maxSpeed
+    }
+
+    // Fraction of the travel covered at fraction `t` of the move time
+    float profileFraction(float t) {
+        if (this->profile == PROFILE_SCURVE) {
+            return t * t * t * (10.0f + t * (-15.0f + 6.0f * t));
+        }
+        if (this->profile == PROFILE_TRAPEZOID) {
+            // Accelerate for ramp, cruise, decelerate for ramp (fractions of the move time)
+            float total = this->moveDuration / 1000.0f;
+            float ramp = min(this->maxSpeed / this->maxAccel / total, 0.5f);
+            float peak = 1.0f / (1.0f - ramp); // Cruise speed, in travel per move time
+            if (t < ramp) return 0.5f * peak * t * t / ramp;
+            if (t > 1.0f - ramp) return 1.0f - 0.5f * peak * (1.0f - t) * (1.0f - t) / ramp;
+            return peak * (t - 0.5f * ramp);
+        }
+        return 1.0f;
+    }
+
+    // Change-only servo writes
+    void writeServos(int clamp1, int clamp2) {
+        if (clamp1 != this->written1) {
+            this->clamp1Servo.write(clamp1);
+            this->written1 = clamp1;
+            eventLog.log(EVENT_SERVO, 1, clamp1);
+        }
+        if (clamp2 != this->written2) {
+            this->clamp2Servo.write(clamp2);
+            this->written2 = clamp2;
+            eventLog.log(EVENT_SERVO, 2, clamp2);
+        }
+        this->clamp1Pos = clamp1;
+        this->clamp2Pos = clamp2;
+    }
 };
+
+#endif
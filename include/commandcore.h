@@ -0,0 +1,215 @@
+// COMMAND CORE
+//
+// The pad command routes (/launch, /abort, /clamps/nudge, ...) independent
+// of the web server that carries them. Each route goes
+//   parse -> validate -> enqueue on the ControlLink -> respond
+// here; a transport only supplies a CommandTransport to read query
+// arguments and send the reply, and registers COMMAND_ROUTES under their
+// paths. The ESP32 WebServer and SimpleWebServer both adapt to it, so the
+// routes and their replies are the same on every board.
+//
+// Each route's latency, from the transport's receive stamp to the reply
+// sent, is kept per route:
+//   route.<command>   received -> reply handed to the transport
+
+#ifndef COMMANDCORE_H
+#define COMMANDCORE_H
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "controllink.h"
+#include "loopstats.h"
+#include "padcommands.h"
+
+#define COMMAND_ARG_SIZE 16     // Longest query argument value read
+
+// Copies query argument `name` into `value`; false if it is absent.
+typedef bool (*QueryArg)(const char* name, char* value, size_t size);
+typedef void (*SendReply)(int code, const char* text);
+
+struct CommandTransport {
+    QueryArg arg;
+    SendReply send;
+};
+
+struct CommandReply {
+    int code;
+    char text[48];
+};
+
+// Reads the route's arguments into `cmd`; false if one is malformed.
+typedef bool (*CommandParser)(QueryArg arg, PadCommandFrame& cmd);
+// Builds a 200 reply from the ack, for routes that report more than `ok`.
+typedef void (*CommandResponder)(const PadAckFrame& ack, CommandReply& reply);
+
+struct CommandRoute {
+    const char* path;
+    uint8_t command;
+    const char* ok;             // 200 body
+    const char* rejected;       // 409 body when the phase does not allow the command
+    CommandParser parse;        // May be null: no arguments
+    CommandResponder respond;   // May be null: reply with `ok`
+};
+
+// Optional integer argument in [min, max]; false if it is present but not a
+// number or out of range.
+inline bool commandArg(QueryArg arg, const char* name, long min, long max, long& value) {
+    char text[COMMAND_ARG_SIZE];
+    if (!arg(name, text, sizeof(text))) {
+        return true;
+    }
+    char* end;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < min || parsed > max) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// /clamps/nudge?clamp1=&clamp2=: one degree step per clamp, -1, 0 or 1
+// (Clamps::nudge moves no further)
+inline bool parseNudge(QueryArg arg, PadCommandFrame& cmd) {
+    long clamp1 = 0, clamp2 = 0;
+    if (!commandArg(arg, "clamp1", -1, 1, clamp1) || !commandArg(arg, "clamp2", -1, 1, clamp2)) {
+        return false;
+    }
+    cmd.arg1 = clamp1;
+    cmd.arg2 = clamp2;
+    return true;
+}
+
+inline void respondPosition(const PadAckFrame& ack, CommandReply& reply) {
+    snprintf(reply.text, sizeof(reply.text), "Position: (%d, %d)", ack.clamp1, ack.clamp2);
+}
+
+enum CommandRouteId {
+    ROUTE_LAUNCH,
+    ROUTE_HOLD,
+    ROUTE_RECYCLE,
+    ROUTE_ARM,
+    ROUTE_DISARM,
+    ROUTE_ABORT,
+    ROUTE_CLAMPS_OPEN,
+    ROUTE_CLAMPS_CLOSE,
+    ROUTE_CLAMPS_NUDGE,
+    COMMAND_ROUTE_COUNT
+};
+
+// Indexed by CommandRouteId
+constexpr CommandRoute COMMAND_ROUTES[COMMAND_ROUTE_COUNT] = {
+    // Start the countdown from ARMED, or resume it from HOLD
+    { "/launch", CMD_LAUNCH, "Countdown started.", "Launch sequence not armed.", nullptr, nullptr },
+    // Freeze the countdown
+    { "/hold", CMD_HOLD, "Countdown held.", "Nothing to hold.", nullptr, nullptr },
+    // Back to ARMED after a hold, abort or launch; re-arms the pyros, so needs the igniter
+    { "/recycle", CMD_RECYCLE, "Sequence recycled.", "Nothing to recycle.", nullptr, nullptr },
+    // Arm the pyros and the sequence, if the igniter is in circuit
+    { "/arm", CMD_ARM, "Armed.", "Sequence running.", nullptr, nullptr },
+    { "/disarm", CMD_DISARM, "Disarmed.", "Sequence running.", nullptr, nullptr },
+    { "/abort", CMD_ABORT, "Abort sequence triggered.", nullptr, nullptr, nullptr },
+    { "/clamps/open", CMD_CLAMPS_OPEN, "Clamps opened.", nullptr, nullptr, nullptr },
+    { "/clamps/close", CMD_CLAMPS_CLOSE, "Clamps closed.", nullptr, nullptr, nullptr },
+    { "/clamps/nudge", CMD_CLAMPS_NUDGE, nullptr, nullptr, parseNudge, respondPosition },
+};
+
+class CommandCore {
+public:
+    // `done` runs on the network side after every command the control side
+    // answered (sounds, log lines); may be null.
+    CommandCore(ControlLink& link, CommandTransport transport, void (*done)(const PadAckFrame& ack) = nullptr)
+        : link(link) {
+        this->transport = transport;
+        this->done = done;
+    }
+
+    // Runs one route for the current request and sends the reply.
+    // `receivedMicros` is when the transport read the request.
+    void serve(int route, uint32_t receivedMicros = micros()) {
+        CommandReply reply;
+        run(COMMAND_ROUTES[route], receivedMicros, reply);
+        this->transport.send(reply.code, reply.text);
+        this->latency[route].record(micros() - receivedMicros);
+    }
+
+    // Hands a decoded frame (e.g. from the WebSocket) to the control side.
+    // False and a BUSY ack if it did not answer.
+    bool call(const PadCommandFrame& cmd, PadAckFrame& ack, uint32_t receivedMicros = micros()) {
+        if (!this->link.call(cmd, ack, receivedMicros)) {
+            ack = { cmd.command, cmd.seq, CMD_STATUS_BUSY, 0, 0, 0 };
+            return false;
+        }
+        if (this->done) {
+            this->done(ack);
+        }
+        return true;
+    }
+
+    void resetStats() {
+        for (int i = 0; i < COMMAND_ROUTE_COUNT; i++) {
+            this->latency[i].reset();
+        }
+    }
+
+    // One line per route that has been served
+    size_t format(char* buffer, size_t size) const {
+        size_t len = 0;
+        for (int i = 0; i < COMMAND_ROUTE_COUNT && len < size; i++) {
+            if (this->latency[i].count == 0) {
+                continue;
+            }
+            char name[40];
+            snprintf(name, sizeof(name), "route.%s", PAD_COMMAND_NAMES[COMMAND_ROUTES[i].command]);
+            int written = this->latency[i].format(buffer + len, size - len, name);
+            if (written < 0) break;
+            len += (size_t)written < size - len ? (size_t)written : size - len - 1;
+        }
+        return len;
+    }
+
+private:
+    ControlLink& link;
+    CommandTransport transport;
+    void (*done)(const PadAckFrame& ack);
+    CycleHistogram latency[COMMAND_ROUTE_COUNT];
+
+    void run(const CommandRoute& route, uint32_t receivedMicros, CommandReply& reply) {
+        Serial.print(F("Received "));
+        Serial.print(route.path);
+        Serial.println(F(" command"));
+        PadCommandFrame cmd = { route.command, 0, 0, 0 };
+        if (route.parse && !route.parse(this->transport.arg, cmd)) {
+            setReply(reply, 400, "Bad arguments.");
+            return;
+        }
+        PadAckFrame ack;
+        if (!call(cmd, ack, receivedMicros)) {
+            setReply(reply, 503, "Control loop busy.");
+            return;
+        }
+        switch (ack.status) {
+            case CMD_STATUS_OK:
+                setReply(reply, 200, route.ok ? route.ok : "OK.");
+                if (route.respond) {
+                    route.respond(ack, reply);
+                }
+                break;
+            case CMD_STATUS_NO_CONTINUITY:
+                setReply(reply, 409, "No igniter continuity.");
+                break;
+            case CMD_STATUS_REJECTED:
+                setReply(reply, 409, route.rejected ? route.rejected : "Not allowed now.");
+                break;
+            default:
+                setReply(reply, 500, "Command failed.");
+                break;
+        }
+    }
+
+    static void setReply(CommandReply& reply, int code, const char* text) {
+        reply.code = code;
+        snprintf(reply.text, sizeof(reply.text), "%s", text);
+    }
+};
+
+#endif
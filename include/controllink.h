@@ -0,0 +1,254 @@
+// CONTROL LINK
+//
+// Carries pad commands from the network side to the control loop and their
+// acks back, over SpscQueues, plus the latest PadState snapshot the other
+// way. The network side must be a single task/core, and so must the control
+// side.
+//
+// Settings changes and stat resets that do not fit a PadCommandFrame go as
+// jobs (run()): a function and a few bytes of data, run by serve() in line
+// with the commands.
+//
+// Every request has a deadline, timeoutMs after it was queued. serve()
+// drops a request it takes after its deadline, and call() only gives up
+// once the deadline has passed and the control side is not running that
+// request. A call that returns false therefore never runs later: a /launch
+// answered 503 cannot start the countdown afterwards.
+//
+// Aborts travel in a lane of their own that serve() empties before every
+// other command, so an abort never waits behind queued clamp moves. An abort
+// also drops every request queued before it. Each command is stamped when it
+// is received, dequeued and actuated; the waits are kept per command type:
+//   command.<name>.wait   received -> dequeued on the control side
+//   command.<name>.total  received -> executed (pins written)
+
+#ifndef CONTROLLINK_H
+#define CONTROLLINK_H
+#include <Arduino.h>
+#include <string.h>
+#include <type_traits>
+#include "crosscore.h"
+#include "padcommands.h"
+#include "padstate.h"
+#include "loopstats.h"
+#include "eventlog.h"
+
+#define CONTROL_LINK_QUEUE_SIZE 16      // Power of two
+#define CONTROL_LINK_TIMEOUT_MS 50      // How long call() waits for the control loop
+#define CONTROL_LINK_JOB_SIZE 32        // Bytes of data a job takes and hands back
+#define CONTROL_LINK_JOB 0xFF           // Command number jobs are logged under
+
+class ControlLink {
+public:
+    typedef PadAckFrame (*Executor)(const PadCommandFrame& cmd);
+
+    // `wait` is run while call() waits for an ack: a vTaskDelay() to let the
+    // other core work, or (with no second core) one pass of the control loop.
+    ControlLink(void (*wait)()) {
+        this->wait = wait;
+    }
+
+    // Network side: hands `cmd` to the control loop and waits for its ack.
+    // `receivedMicros` is when the command came in, for the latency stats.
+    // False if the command was not run and never will be: the queue was
+    // full, the control side did not take it within timeoutMs, or an abort
+    // dropped it.
+    bool call(const PadCommandFrame& cmd, PadAckFrame& ack, uint32_t receivedMicros = micros(),
+        unsigned long timeoutMs = CONTROL_LINK_TIMEOUT_MS) {
+        Request request = {};
+        request.cmd = cmd;
+        request.receivedMicros = receivedMicros;
+        Reply reply;
+        if (!send(request, reply, timeoutMs)) {
+            return false;
+        }
+        ack = reply.ack;
+        return true;
+    }
+
+    // Network side: runs job(data) on the control side and copies `data`
+    // back. CMD_STATUS_OK or CMD_STATUS_REJECTED as the job returns true or
+    // false, CMD_STATUS_BUSY if it was not run (as for call()).
+    template <typename T, bool (*job)(T& data)>
+    uint8_t run(T& data, unsigned long timeoutMs = CONTROL_LINK_TIMEOUT_MS) {
+        static_assert(sizeof(T) <= CONTROL_LINK_JOB_SIZE, "Job data does not fit CONTROL_LINK_JOB_SIZE");
+        static_assert(std::is_trivially_copyable<T>::value, "Job data is copied between the cores");
+        Request request = {};
+        request.cmd.command = CONTROL_LINK_JOB;
+        request.receivedMicros = micros();
+        request.job = &ControlLink::runJob<T, job>;
+        memcpy(request.data, &data, sizeof(T));
+        Reply reply;
+        if (!send(request, reply, timeoutMs)) {
+            return CMD_STATUS_BUSY;
+        }
+        memcpy(&data, reply.data, sizeof(T));
+        return reply.ack.status;
+    }
+
+    // Network side
+    PadState state() const {
+        return this->snapshot.read();
+    }
+
+    // Control side: runs every queued command and job, aborts first. Call
+    // once per control tick.
+    void serve(Executor execute) {
+        if (this->resetRequested.load(std::memory_order_acquire)) {
+            this->resetRequested.store(false, std::memory_order_relaxed);
+            for (int i = 0; i < PAD_COMMAND_COUNT; i++) {
+                this->latency[i].wait.reset();
+                this->latency[i].total.reset();
+            }
+        }
+        Request request;
+        while (this->aborts.pop(request) || this->requests.pop(request)) {
+            this->serving.store(request.ticket); // Before the deadline check; see send()
+            uint32_t dequeued = micros();
+            Reply reply;
+            reply.ticket = request.ticket;
+            if (dequeued - request.queuedMicros >= request.timeoutMicros) {
+                drop(request);
+                this->serving.store(0);
+                continue;
+            }
+            if (request.cmd.command == CMD_ABORT) {
+                Request pending;
+                while (this->requests.pop(pending)) {
+                    drop(pending);
+                }
+            }
+            if (request.job) {
+                memcpy(reply.data, request.data, CONTROL_LINK_JOB_SIZE);
+                bool done = request.job(reply.data);
+                reply.ack = { CONTROL_LINK_JOB, 0, (uint8_t)(done ? CMD_STATUS_OK : CMD_STATUS_REJECTED), 0, 0, 0 };
+            }
+            else {
+                reply.ack = execute(request.cmd);
+            }
+            uint32_t actuated = micros();
+            eventLog.log(EVENT_COMMAND_DONE, request.cmd.command, reply.ack.status);
+            this->replies.push(reply);
+            this->serving.store(0);
+            if (request.cmd.command < PAD_COMMAND_COUNT) {
+                this->latency[request.cmd.command].wait.record(dequeued - request.receivedMicros);
+                this->latency[request.cmd.command].total.record(actuated - request.receivedMicros);
+            }
+        }
+    }
+
+    // Control side
+    void publish(const PadState& state) {
+        this->snapshot.publish(state);
+    }
+
+    // Network side: clears the latency stats on the next serve().
+    void resetStats() {
+        this->resetRequested.store(true, std::memory_order_release);
+    }
+
+    // One line per histogram, for command types that have been seen.
+    // Read from the network side while the control side records, so a
+    // line can be off by the command in flight.
+    size_t format(char* buffer, size_t size) const {
+        size_t len = 0;
+        for (int i = 0; i < PAD_COMMAND_COUNT && len < size; i++) {
+            if (this->latency[i].total.count == 0) {
+                continue;
+            }
+            char name[40];
+            snprintf(name, sizeof(name), "command.%s.wait", PAD_COMMAND_NAMES[i]);
+            len += clampLen(this->latency[i].wait.format(buffer + len, size - len, name), size - len);
+            if (len >= size) break;
+            snprintf(name, sizeof(name), "command.%s.total", PAD_COMMAND_NAMES[i]);
+            len += clampLen(this->latency[i].total.format(buffer + len, size - len, name), size - len);
+        }
+        return len;
+    }
+
+private:
+    struct Request {
+        PadCommandFrame cmd;
+        uint32_t ticket;
+        uint32_t receivedMicros;
+        uint32_t queuedMicros;
+        uint32_t timeoutMicros;     // Deadline, from queuedMicros
+        bool (*job)(void* data);    // Null for a command
+        alignas(8) uint8_t data[CONTROL_LINK_JOB_SIZE];
+    };
+
+    struct Reply {
+        PadAckFrame ack;
+        uint32_t ticket;
+        alignas(8) uint8_t data[CONTROL_LINK_JOB_SIZE];
+    };
+
+    void (*wait)();
+    uint32_t nextTicket = 0;
+    std::atomic<uint32_t> serving{ 0 };     // Ticket serve() is on, 0 between requests
+    SpscQueue<Request, CONTROL_LINK_QUEUE_SIZE> aborts;
+    SpscQueue<Request, CONTROL_LINK_QUEUE_SIZE> requests;
+    SpscQueue<Reply, CONTROL_LINK_QUEUE_SIZE> replies;
+    SharedSnapshot<PadState> snapshot;
+
+    struct Latency {
+        CycleHistogram wait;
+        CycleHistogram total;
+    };
+    Latency latency[PAD_COMMAND_COUNT];
+    std::atomic<bool> resetRequested{ false };
+
+    template <typename T, bool (*job)(T& data)>
+    static bool runJob(void* data) {
+        return job(*(T*)data);
+    }
+
+    // Network side: queues `request` and waits for its reply. False if it
+    // was dropped, or its deadline passed before serve() took it (serve()
+    // drops it when it does).
+    bool send(Request& request, Reply& reply, unsigned long timeoutMs) {
+        eventLog.log(EVENT_COMMAND, request.cmd.command, request.cmd.seq);
+        if (++this->nextTicket == 0) {
+            ++this->nextTicket; // 0 is serving's idle value
+        }
+        request.ticket = this->nextTicket;
+        request.timeoutMicros = timeoutMs * 1000;
+        request.queuedMicros = micros();
+        SpscQueue<Request, CONTROL_LINK_QUEUE_SIZE>& lane = request.cmd.command == CMD_ABORT ? this->aborts : this->requests;
+        if (!lane.push(request)) {
+            return false;
+        }
+        for (;;) {
+            bool expired = micros() - request.queuedMicros >= request.timeoutMicros;
+            // serve() marks a request as taken before it checks the deadline,
+            // so if it is not marked now, serve() will see it expired.
+            bool taken = this->serving.load() == request.ticket;
+            while (this->replies.pop(reply)) {
+                if (reply.ticket == request.ticket) {
+                    return reply.ack.status != CMD_STATUS_BUSY;
+                }
+                // Otherwise a late reply for a call that already gave up
+            }
+            if (expired && !taken) {
+                return false;
+            }
+            this->wait();
+        }
+    }
+
+    // Control side: answers a request without running it
+    void drop(const Request& request) {
+        Reply reply;
+        reply.ticket = request.ticket;
+        reply.ack = { request.cmd.command, request.cmd.seq, CMD_STATUS_BUSY, 0, 0, 0 };
+        eventLog.log(EVENT_COMMAND_DONE, request.cmd.command, CMD_STATUS_BUSY);
+        this->replies.push(reply);
+    }
+
+    static size_t clampLen(int written, size_t size) {
+        if (written < 0) return 0;
+        return (size_t)written < size ? (size_t)written : size - 1;
+    }
+};
+
+#endif
@@ -0,0 +1,88 @@
+// CROSS-CORE HAND-OFF
+//
+// Lock-free building blocks for splitting the firmware across two cores:
+// the network side takes requests and the control side drives the pad.
+//
+//   SpscQueue<T, N>      single-producer single-consumer ring
+//   SharedSnapshot<T>    one writer publishes, any reader copies (seqlock)
+//
+// Only aligned 32-bit loads and stores are used, so both work on the
+// Cortex-M0+ (no exclusive-access instructions) as well as on the ESP32.
+
+#ifndef CROSSCORE_H
+#define CROSSCORE_H
+#include <Arduino.h>
+#include <atomic>
+
+// N must be a power of two; the queue holds up to N - 1 items.
+template <typename T, uint32_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    // Producer side
+    bool push(const T& item) {
+        uint32_t head = this->head.load(std::memory_order_relaxed);
+        uint32_t next = (head + 1) & (N - 1);
+        if (next == this->tail.load(std::memory_order_acquire)) {
+            return false; // Full
+        }
+        this->items[head] = item;
+        this->head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        uint32_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail == this->head.load(std::memory_order_acquire)) {
+            return false; // Empty
+        }
+        item = this->items[tail];
+        this->tail.store((tail + 1) & (N - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return this->tail.load(std::memory_order_acquire) == this->head.load(std::memory_order_acquire);
+    }
+
+private:
+    T items[N];
+    std::atomic<uint32_t> head{ 0 };   // Next slot to write (producer)
+    std::atomic<uint32_t> tail{ 0 };   // Next slot to read (consumer)
+};
+
+template <typename T>
+class SharedSnapshot {
+public:
+    // Writer side; never blocks.
+    void publish(const T& value) {
+        uint32_t seq = this->seq.load(std::memory_order_relaxed);
+        this->seq.store(seq + 1, std::memory_order_relaxed); // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        this->value = value;
+        std::atomic_thread_fence(std::memory_order_release);
+        this->seq.store(seq + 2, std::memory_order_relaxed);
+    }
+
+    // Reader side; retries while a publish() overlaps the copy.
+    T read() const {
+        T copy;
+        uint32_t before, after;
+        do {
+            before = this->seq.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            copy = this->value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = this->seq.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return copy;
+    }
+
+private:
+    T value;
+    std::atomic<uint32_t> seq{ 0 };
+};
+
+#endif
@@ -0,0 +1,239 @@
+// EVENT LOG
+//
+// Fixed-size binary records of what the pad did, kept in RAM so they can
+// stay enabled through a launch:
+//
+//   [micros u32][type u8][a u8][b u16]     8 bytes, little-endian
+//
+// Each core writes its own ring with interrupts masked for the few
+// instructions it takes (the pyro timer callback can interrupt the control
+// loop), so no atomic read-modify-write is needed; the Cortex-M0+ has none.
+// A ring keeps the newest EVENT_LOG_SIZE records and overwrites the oldest.
+// EventLogReader merges the rings by time and skips records that were
+// overwritten while it read them.
+//
+// Timestamps come straight from the hardware timer (time_us_32() on RP2040,
+// esp_timer on ESP32), not from micros(); they are only comparable with
+// each other.
+
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+#include <Arduino.h>
+#include <atomic>
+#include <stdio.h>
+#if USE_RP2040
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "pico/platform.h"
+#elif USE_ESP32
+#include <esp_timer.h>
+#endif
+
+#define EVENT_LOG_SIZE 1024     // Records per core; power of two
+#define EVENT_LOG_CORES 2
+
+enum EventType : uint8_t {
+    EVENT_COMMAND,          // a = command, b = seq; received by the network side
+    EVENT_COMMAND_DONE,     // a = command, b = status; executed by the control side
+    EVENT_PYRO_ON,          // a = channel
+    EVENT_PYRO_OFF,         // a = channel
+    EVENT_SERVO,            // a = clamp (1 or 2), b = angle written
+    EVENT_LOOP_OVERRUN,     // b = iteration time in us (65535 = that or more)
+    EVENT_PYRO_REFUSED,     // fire() while the pyro bank was not armed
+    EVENT_TYPE_COUNT
+};
+
+const char* const EVENT_TYPE_NAMES[EVENT_TYPE_COUNT] = {
+    "command", "command_done", "pyro_on", "pyro_off", "servo", "loop_overrun", "pyro_refused"
+};
+
+struct LogRecord {
+    uint32_t micros;
+    uint8_t type;
+    uint8_t a;
+    uint16_t b;
+};
+
+const size_t LOG_RECORD_SIZE = sizeof(LogRecord);
+static_assert(LOG_RECORD_SIZE == 8, "LogRecord must stay 8 bytes");
+
+class EventLog {
+public:
+    void log(EventType type, uint8_t a = 0, uint16_t b = 0) {
+    #if USE_RP2040
+        uint32_t state = save_and_disable_interrupts();
+        Ring& ring = this->rings[get_core_num()];
+    #elif USE_ESP32
+        UBaseType_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+        Ring& ring = this->rings[xPortGetCoreID()];
+    #else
+        Ring& ring = this->rings[0];
+    #endif
+        uint32_t head = ring.head.load(std::memory_order_relaxed);
+        LogRecord& record = ring.records[head & (EVENT_LOG_SIZE - 1)];
+        record.micros = now();
+        record.type = type;
+        record.a = a;
+        record.b = b;
+        ring.head.store(head + 1, std::memory_order_release);
+    #if USE_RP2040
+        restore_interrupts(state);
+    #elif USE_ESP32
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+    #endif
+    }
+
+    // Records logged on a core since boot
+    uint32_t count(int core) const {
+        return this->rings[core].head.load(std::memory_order_relaxed);
+    }
+
+    static uint32_t now() {
+    #if USE_RP2040
+        return time_us_32();
+    #elif USE_ESP32
+        return (uint32_t)esp_timer_get_time();
+    #else
+        return micros();
+    #endif
+    }
+
+private:
+    friend class EventLogReader;
+
+    struct Ring {
+        LogRecord records[EVENT_LOG_SIZE];
+        std::atomic<uint32_t> head{ 0 };    // Records ever written
+        uint32_t start = 0;                 // First record not consumed (reader side)
+    };
+
+    Ring rings[EVENT_LOG_CORES];
+};
+
+EventLog eventLog;
+
+// Reads a consistent, time-ordered copy of the log as it stood when the
+// reader was made; records logged afterwards are left for the next reader.
+// Use from one task at a time.
+class EventLogReader {
+public:
+    uint32_t dropped = 0;   // Records overwritten before they could be read
+
+    EventLogReader(EventLog& log) : log(log) {
+        for (int i = 0; i < EVENT_LOG_CORES; i++) {
+            EventLog::Ring& ring = log.rings[i];
+            this->end[i] = ring.head.load(std::memory_order_acquire);
+            this->next[i] = ring.start;
+            if (this->end[i] - this->next[i] > EVENT_LOG_SIZE) {
+                this->dropped += this->end[i] - this->next[i] - EVENT_LOG_SIZE;
+                this->next[i] = this->end[i] - EVENT_LOG_SIZE;
+            }
+            this->pending[i] = false;
+        }
+    }
+
+    // The next record in time order and the core that logged it.
+    bool read(LogRecord& record, int& core) {
+        int oldest = -1;
+        for (int i = 0; i < EVENT_LOG_CORES; i++) {
+            if (!this->pending[i]) {
+                this->pending[i] = fetch(i, this->heads[i]);
+            }
+            if (this->pending[i] && (oldest < 0 || (int32_t)(this->heads[i].micros - this->heads[oldest].micros) < 0)) {
+                oldest = i;
+            }
+        }
+        if (oldest < 0) {
+            return false;
+        }
+        record = this->heads[oldest];
+        core = oldest;
+        this->pending[oldest] = false;
+        return true;
+    }
+
+    // Hides the records this reader covers from later readers.
+    void consume() {
+        for (int i = 0; i < EVENT_LOG_CORES; i++) {
+            this->log.rings[i].start = this->end[i];
+        }
+    }
+
+    // Fills `buffer` with whole "us,core,event,a,b" lines, after a header line
+    // on the first call; 0 once the log is exhausted.
+    size_t readCsv(char* buffer, size_t size) {
+        size_t len = 0;
+        if (!this->headerSent) {
+            int n = snprintf(buffer, size, "us,core,event,a,b\n");
+            if (n < 0 || (size_t)n >= size) return 0;
+            len = n;
+            this->headerSent = true;
+        }
+        LogRecord record;
+        int core;
+        while (len < size && (this->hasHeld || read(record, core))) {
+            if (this->hasHeld) {
+                record = this->held;
+                core = this->heldCore;
+            }
+            int n = snprintf(buffer + len, size - len, "%lu,%d,%s,%u,%u\n",
+                (unsigned long)record.micros, core,
+                record.type < EVENT_TYPE_COUNT ? EVENT_TYPE_NAMES[record.type] : "unknown",
+                record.a, record.b);
+            if (n < 0 || (size_t)n >= size - len) {
+                // Line does not fit; keep it for the next call
+                this->held = record;
+                this->heldCore = core;
+                this->hasHeld = true;
+                break;
+            }
+            this->hasHeld = false;
+            len += n;
+        }
+        return len;
+    }
+
+    // Fills `buffer` with whole 8-byte records (the core in the top bit of
+    // the type byte); 0 once the log is exhausted.
+    size_t readBinary(uint8_t* buffer, size_t size) {
+        size_t len = 0;
+        LogRecord record;
+        int core;
+        while (len + LOG_RECORD_SIZE <= size && read(record, core)) {
+            record.type |= core << 7;
+            memcpy(buffer + len, &record, LOG_RECORD_SIZE);
+            len += LOG_RECORD_SIZE;
+        }
+        return len;
+    }
+
+private:
+    EventLog& log;
+    uint32_t next[EVENT_LOG_CORES];
+    uint32_t end[EVENT_LOG_CORES];
+    LogRecord heads[EVENT_LOG_CORES];
+    bool pending[EVENT_LOG_CORES];
+    LogRecord held{};
+    int heldCore = 0;
+    bool hasHeld = false;
+    bool headerSent = false;
+
+    // Copies the core's next record; skips ahead past any the writer has
+    // overwritten in the meantime.
+    bool fetch(int core, LogRecord& record) {
+        EventLog::Ring& ring = this->log.rings[core];
+        while (this->next[core] != this->end[core]) {
+            uint32_t index = this->next[core]++;
+            record = ring.records[index & (EVENT_LOG_SIZE - 1)];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint32_t head = ring.head.load(std::memory_order_relaxed);
+            if (head - index < EVENT_LOG_SIZE) {
+                return true;
+            }
+            this->dropped++;
+        }
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,54 @@
+// GPIO MASK WRITES
+//
+// Drives several outputs in one register write, so they switch together:
+//   RP2040: SIO gpio_togl, one write sets and clears any mix of GPIOs 0-29
+//   ESP32:  GPIO.out_w1ts / out_w1tc, GPIOs 0-31 (set, then clear)
+//   native: the mock HAL pins, bit n = pin n
+// Masks are in GPIO numbers, not Arduino pin numbers; use gpioMaskForPin().
+
+#ifndef GPIOMASK_H
+#define GPIOMASK_H
+#include <Arduino.h>
+#if USE_RP2040
+#include "hardware/structs/sio.h"
+#elif USE_ESP32
+#include "soc/gpio_struct.h"
+#endif
+
+// Mask bit for an Arduino pin, or 0 if the pin cannot be driven by mask writes.
+inline uint32_t gpioMaskForPin(int pin) {
+#if USE_RP2040
+    int gpio = (int)digitalPinToPinName(pin);
+    return gpio >= 0 && gpio < 30 ? 1UL << gpio : 0;
+#elif USE_ESP32
+#ifdef BOARD_HAS_PIN_REMAP
+    int gpio = digitalPinToGPIONumber(pin);
+#else
+    int gpio = pin;
+#endif
+    return gpio >= 0 && gpio < 32 ? 1UL << gpio : 0;
+#else
+    return pin >= 0 && pin < 32 ? 1UL << pin : 0;
+#endif
+}
+
+// Sets the bits in `set` high and the bits in `clear` low.
+inline void gpioWriteMask(uint32_t set, uint32_t clear) {
+#if USE_RP2040
+    uint32_t mask = set | clear;
+    sio_hw->gpio_togl = (sio_hw->gpio_out ^ set) & mask;
+#elif USE_ESP32
+    if (set) GPIO.out_w1ts = set;
+    if (clear) GPIO.out_w1tc = clear;
+#else
+    for (int i = 0; i < 32; i++) {
+        uint32_t bit = 1UL << i;
+        if ((set | clear) & bit) {
+            NativeHAL::pins[i].value = (set & bit) ? HIGH : LOW;
+            NativeHAL::pins[i].writes++;
+        }
+    }
+#endif
+}
+
+#endif
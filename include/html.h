@@ -1,262 +1,255 @@
-const char PROGMEM index_html[] = R"indexhtml(<!DOCTYPE html>
-<html lang="en">
-
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Launch Pad Control</title>
-    <style>
-        :root {
-            --bg-color: #0e0e0e;
-            --text-color: #f5f5f5;
-            --status-text-color: #aaaaaa;
-            --launch-bg: #28a745;
-            --launch-hover-bg: #218838;
-            --abort-bg: #dc3545;
-            --abort-hover-bg: #c82333;
-            --clamp-bg: #007bff;
-            --clamp-hover-bg: #0069d9;
-            --button-text-color: white;
-            --container-bg: #1a1a1a;
-        }
-
-        body {
-            background-color: var(--bg-color);
-            color: var(--text-color);
-            font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif, monospace;
-            text-align: center;
-            margin: 0;
-            padding: 20px;
-            display: flex;
-            flex-direction: column;
-            align-items: center;
-            min-height: 100vh;
-            box-sizing: border-box;
-        }
-
-        .container {
-            background-color: var(--container-bg);
-            padding: 20px;
-            border-radius: 12px;
-            box-shadow: 0 4px 15px rgba(0, 0, 0, 0.3);
-            width: 100%;
-            max-width: 500px;
-            box-sizing: border-box;
-        }
-
-        h1 {
-            font-size: clamp(1.5em, 5vw, 2em);
-            margin-bottom: 30px;
-        }
-
-        .controls-grid {
-            display: grid;
-            grid-template-columns: 1fr;
-            gap: 20px;
-            margin-bottom: 20px;
-        }
-
-        .control-group {
-            display: flex;
-            flex-direction: column;
-            align-items: center;
-            gap: 10px;
-        }
-
-        .button-row {
-            display: flex;
-            flex-wrap: wrap;
-            justify-content: center;
-            align-items: center;
-            gap: 15px;
-            width: 100%;
-        }
-
-        .button {
-            padding: 15px 25px;
-            font-size: clamp(1em, 4vw, 1.2em);
-            border: none;
-            border-radius: 8px;
-            cursor: pointer;
-            transition: background-color 0.3s ease, transform 0.1s ease;
-            color: var(--button-text-color);
-            min-width: 150px;
-            flex-grow: 1;
-            max-width: 220px;
-        }
-
-        .button.nudge {
-            min-width: 60px;
-            max-width: 100px;
-            padding: 10px 15px;
-            font-size: 1.1em;
-        }
-
-        .button:active {
-            transform: translateY(1px);
-        }
-
-        .launch {
-            background-color: var(--launch-bg);
-        }
-
-        .launch:hover {
-            background-color: var(--launch-hover-bg);
-        }
-
-        .abort {
-            background-color: var(--abort-bg);
-        }
-
-        .abort:hover {
-            background-color: var(--abort-hover-bg);
-        }
-
-        .clamp {
-            background-color: var(--clamp-bg);
-        }
-
-        .clamp:hover {
-            background-color: var(--clamp-hover-bg);
-        }
-
-        .status-display {
-            font-size: clamp(1em, 3.5vw, 1.1em);
-            color: var(--text-color);
-            background-color: rgba(255, 255, 255, 0.05);
-            padding: 10px 15px;
-            border-radius: 6px;
-            min-height: 1.5em;
-            width: 100%;
-            max-width: 300px;
-            box-sizing: border-box;
-            word-wrap: break-word;
-        }
-
-        #overall-status {
-            margin-top: 30px;
-            font-size: clamp(1em, 4vw, 1.2em);
-            color: var(--status-text-color);
-            padding: 10px;
-            background-color: var(--bg-color);
-            border-radius: 6px;
-            border: 1px solid var(--container-bg);
-        }
-    </style>
-</head>
-
-<body>
-    <div class="container">
-        <h1>🚀 Launch Pad Control</h1>
-
-        <div class="controls-grid">
-            <div class="control-group">
-                <div class="button-row">
-                    <button class="button launch" onclick="confirmLaunch()">Launch</button>
-                    <button class="button abort" onclick="triggerAbort()">Abort</button>
-                </div>
-                <div id="launch-status" class="status-display">Ready to launch</div>
-            </div>
-
-            <div class="control-group">
-                <div class="button-row">
-                    <button class="button clamp" onclick="triggerOpenClamps()">Open Clamps</button>
-                    <button class="button clamp" onclick="triggerCloseClamps()">Close Clamps</button>
-                </div>
-                <div class="button-row">
-                    <div>Clamp 1:</div>
-                    <button class="button clamp nudge" onclick="triggerNudge(1, 1)">+</button>
-                    <button class="button clamp nudge" onclick="triggerNudge(1, -1)">-</button>
-                </div>
-                <div class="button-row">
-                    <div>Clamp 2:</div>
-                    <button class="button clamp nudge" onclick="triggerNudge(2, 1)">+</button>
-                    <button class="button clamp nudge" onclick="triggerNudge(2, -1)">-</button>
-                </div>
-                <div id="clamp-status" class="status-display">Clamps Closed</div>
-            </div>
-        </div>
-
-        <div id="overall-status">System idle.</div>
-    </div>
-
-    <script>
-        let countdownInterval;
-
-        function sendCommand(endpoint, statusElementId, successMessage, immediateStatus) {
-            const statusEl = document.getElementById("overall-status");
-            const specificStatusEl = document.getElementById(statusElementId);
-
-            if (immediateStatus && specificStatusEl) {
-                specificStatusEl.innerText = immediateStatus;
-            }
-            if (statusEl) statusEl.innerText = "Sending request...";
-
-            fetch(endpoint)
-                .then(response => {
-                    if (!response.ok) throw new Error("Network: " + response.statusText);
-                    return response.text();
-                })
-                .then(text => {
-                    if (statusEl) statusEl.innerText = "Server: " + text;
-                    if (specificStatusEl) {
-                        // If a static successMessage is provided, use it. 
-                        // Otherwise, use the text received from the server as the status.
-                        specificStatusEl.innerText = successMessage ? successMessage : text;
-                    }
-                })
-                .catch(error => {
-                    statusEl.style.color = "red";
-                    if (statusEl) statusEl.innerText = "Error: " + error.message;
-                    if (specificStatusEl) {
-                        specificStatusEl.style.color = "red";
-                        specificStatusEl.innerText = "Action failed";
-                    }
-                    setTimeout(() => {
-                        if (statusEl) statusEl.style.color = "var(--status-text-color)";
-                        if (specificStatusEl) specificStatusEl.style.color = "var(--text-color)";
-                    }, 1000);
-                });
-        }
-
-        function confirmLaunch() {
-            const confirmLaunch = confirm("Are you sure you want to launch?");
-            if (confirmLaunch) {
-                triggerLaunch();
-            }
-        }
-
-        function triggerLaunch() {
-            sendCommand("/launch", "launch-status", "Launch initiated", "Preparing for launch...");
-        }
-
-        function triggerAbort() {
-            clearInterval(countdownInterval);
-            const launchStatusEl = document.getElementById("launch-status");
-            if (launchStatusEl) launchStatusEl.innerText = "ABORTING...";
-            sendCommand("/abort", "launch-status", "Aborted!");
-        }
-
-        function triggerCloseClamps() {
-            sendCommand("/clamps/close", "clamp-status", "Clamps Closed", "Closing Clamps...");
-        }
-
-        function triggerOpenClamps() {
-            sendCommand("/clamps/open", "clamp-status", "Clamps Open", "Opening Clamps...");
-        }
-
-        /**
-         * NEW: Function to trigger clamp nudge
-         * @param {number} clampNum - The clamp to nudge (1 or 2)
-         * @param {number} direction - The direction to nudge (-1 for down, 1 for up)
-         */
-        function triggerNudge(clampNum, direction) {
-            const endpoint = `/clamps/nudge?clamp${clampNum}=${direction}`;
-            // The server's response will contain the new position, so we pass null 
-            // for the successMessage argument to let sendCommand use the response text directly.
-            sendCommand(endpoint, "clamp-status", null, `Nudging Clamp ${clampNum}...`);
-        }
-    </script>
-</body>
-
-</html>)indexhtml";
\ No newline at end of file
+// Generated by build.py from data/index.html. Do not edit.
+// 14988 bytes, 3897 bytes gzipped
+#ifndef HTML_H
+#define HTML_H
+
+const char index_html_etag[] = "\"658b9e2894150702\"";
+const size_t index_html_gz_len = 3897;
+const uint8_t PROGMEM index_html_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1b, 0xed, 0x72, 0xe3, 0xb6,
+    0xf1, 0xff, 0x3d, 0x05, 0xc2, 0x5c, 0x13, 0x29, 0x27, 0x51, 0x1f, 0x3e, 0x27, 0x8e, 0x6c, 0x39,
+    0xf5, 0xc9, 0xbe, 0x3b, 0x37, 0xb6, 0xe4, 0xb1, 0xe4, 0x64, 0x6e, 0x6e, 0x3c, 0x31, 0x44, 0x42,
+    0x12, 0x7b, 0x14, 0xa9, 0x10, 0x94, 0x65, 0xd5, 0xd1, 0x4c, 0x9f, 0xa3, 0x7f, 0xfa, 0x8a, 0x7d,
+    0x84, 0xee, 0x02, 0xfc, 0x84, 0x40, 0x49, 0x76, 0xef, 0xda, 0xfa, 0x32, 0x36, 0x09, 0x2c, 0x76,
+    0x17, 0xfb, 0x8d, 0x05, 0x73, 0xf4, 0xd5, 0x69, 0xaf, 0x33, 0xf8, 0x70, 0x75, 0x46, 0x26, 0xe1,
+    0xd4, 0x3d, 0x7e, 0x71, 0x84, 0x7f, 0x88, 0x4b, 0xbd, 0x71, 0xdb, 0x60, 0x9e, 0x71, 0xfc, 0x02,
+    0x46, 0x18, 0xb5, 0x8f, 0x5f, 0x10, 0xf8, 0x39, 0x9a, 0xb2, 0x90, 0x12, 0x6b, 0x42, 0x03, 0xce,
+    0xc2, 0xb6, 0x71, 0x33, 0x78, 0x5b, 0x3d, 0x30, 0xb2, 0x53, 0x1e, 0x9d, 0xb2, 0xb6, 0x71, 0xef,
+    0xb0, 0xc5, 0xcc, 0x0f, 0x42, 0x83, 0x58, 0xbe, 0x17, 0x32, 0x0f, 0x40, 0x17, 0x8e, 0x1d, 0x4e,
+    0xda, 0x36, 0xbb, 0x77, 0x2c, 0x56, 0x15, 0x2f, 0x15, 0xe2, 0x78, 0x4e, 0xe8, 0x50, 0xb7, 0xca,
+    0x2d, 0xea, 0xb2, 0x76, 0xc3, 0xac, 0xc7, 0xa8, 0x42, 0x27, 0x74, 0xd9, 0xf1, 0x05, 0x9d, 0x7b,
+    0xd6, 0x84, 0x5c, 0x51, 0x9b, 0x74, 0x00, 0x4d, 0xe0, 0xbb, 0x47, 0x35, 0x39, 0x23, 0xa1, 0x78,
+    0xb8, 0x8c, 0x9f, 0xf1, 0xa7, 0x15, 0xf8, 0x7e, 0x48, 0x1e, 0x93, 0x77, 0xfc, 0xa9, 0x56, 0x87,
+    0xe3, 0xaa, 0xe5, 0xbb, 0x7e, 0xd0, 0x22, 0x5f, 0xd7, 0x19, 0xfe, 0x3b, 0x54, 0x00, 0x42, 0xf6,
+    0x10, 0x26, 0x20, 0xa3, 0x7d, 0xfc, 0xa7, 0x82, 0xf0, 0x90, 0x86, 0x73, 0x9e, 0x87, 0xa4, 0xe2,
+    0x47, 0x85, 0x74, 0x05, 0xcb, 0x40, 0x14, 0x20, 0x9a, 0x07, 0xf4, 0x87, 0xd7, 0xfb, 0x05, 0x10,
+    0x13, 0xff, 0x9e, 0x05, 0x11, 0x5c, 0xe3, 0xe0, 0x60, 0xef, 0x40, 0x85, 0xa3, 0x43, 0x90, 0x9f,
+    0x04, 0xb0, 0xad, 0xbd, 0xfd, 0x75, 0x44, 0x12, 0x20, 0x83, 0xc7, 0x3a, 0x68, 0xee, 0xed, 0xed,
+    0xa9, 0x60, 0x96, 0x4b, 0xa7, 0x33, 0x09, 0x50, 0xaf, 0xff, 0x30, 0x1c, 0x8d, 0xf4, 0x00, 0x19,
+    0x3c, 0xf5, 0xfa, 0xf7, 0x3f, 0xda, 0x3f, 0xaa, 0x60, 0xc3, 0x79, 0x18, 0xfa, 0x5e, 0x4e, 0x06,
+    0x8b, 0x89, 0x13, 0xae, 0x89, 0x13, 0x15, 0x4e, 0x1d, 0x2f, 0x46, 0xd6, 0xa0, 0xf8, 0x2f, 0x05,
+    0x5a, 0xbd, 0x48, 0x1e, 0x87, 0xbe, 0xbd, 0x54, 0xd4, 0x35, 0xa4, 0xd6, 0xa7, 0x71, 0xe0, 0xcf,
+    0x3d, 0x3b, 0xa6, 0x71, 0x4f, 0x83, 0x52, 0xaa, 0xc4, 0x72, 0x9e, 0x5a, 0x0e, 0x26, 0xe5, 0x4c,
+    0x81, 0x1a, 0x01, 0x47, 0xd5, 0x11, 0x9d, 0x3a, 0xee, 0xb2, 0x45, 0xbe, 0xed, 0xb3, 0xb1, 0xcf,
+    0xc8, 0xcd, 0xf9, 0xb7, 0x15, 0x32, 0xa0, 0x13, 0x7f, 0x4a, 0x2b, 0xe4, 0x1d, 0xf3, 0xd8, 0x3d,
+    0xfc, 0xfd, 0x85, 0x05, 0x36, 0xf5, 0xe0, 0x81, 0x53, 0x8f, 0x57, 0x39, 0x0b, 0x9c, 0x51, 0x85,
+    0x4c, 0x7d, 0xcf, 0xe7, 0x33, 0x6a, 0x29, 0x1b, 0x15, 0xd4, 0xa8, 0xeb, 0x8c, 0xbd, 0x16, 0xb1,
+    0xc0, 0xc0, 0x59, 0x90, 0x9f, 0x9f, 0xd2, 0x60, 0xec, 0xc0, 0x5c, 0x3d, 0x3f, 0x3c, 0xa3, 0xb6,
+    0xed, 0x78, 0x20, 0x98, 0x66, 0x7d, 0xf6, 0x90, 0x9f, 0xb2, 0x1d, 0x3e, 0x73, 0x29, 0xb0, 0x38,
+    0x72, 0x99, 0x32, 0x85, 0x23, 0x55, 0xdb, 0x09, 0x98, 0x15, 0x3a, 0x3e, 0x12, 0xf4, 0xdd, 0xf9,
+    0xd4, 0xcb, 0xc3, 0x08, 0x5e, 0xaa, 0xa0, 0x90, 0x29, 0x2f, 0xe0, 0xc8, 0xf1, 0xaa, 0x13, 0xe6,
+    0x8c, 0x27, 0x61, 0x8b, 0x34, 0xea, 0xf5, 0xfb, 0x49, 0x7e, 0x7a, 0xe8, 0x3f, 0x54, 0xb9, 0xf3,
+    0x37, 0xc1, 0x1c, 0x58, 0x96, 0x8d, 0x0a, 0xf4, 0x1f, 0xb4, 0x8a, 0x33, 0x13, 0x1d, 0xef, 0xa8,
+    0xbe, 0xac, 0x4d, 0x94, 0x77, 0x16, 0x48, 0xc4, 0x45, 0x40, 0x6d, 0x67, 0x0e, 0x7b, 0x6a, 0x34,
+    0xd7, 0x01, 0x80, 0xe5, 0x09, 0xb5, 0xfd, 0x05, 0xc8, 0x99, 0xbc, 0x9e, 0x3d, 0x90, 0xc6, 0x3e,
+    0xfc, 0x0a, 0xc6, 0x43, 0x5a, 0xaa, 0x57, 0x48, 0xf4, 0x9f, 0xb9, 0xa7, 0x90, 0x14, 0xc1, 0x47,
+    0xc8, 0xe0, 0x4f, 0xaa, 0xce, 0x1e, 0xaa, 0xd1, 0xe4, 0x7e, 0xbd, 0xae, 0xa5, 0xb6, 0x9b, 0x80,
+    0x26, 0x0d, 0x45, 0x30, 0xc2, 0x04, 0x61, 0x31, 0x03, 0xd5, 0xa0, 0xbb, 0x95, 0x1a, 0xe6, 0x3e,
+    0x9b, 0x56, 0xc8, 0xfe, 0xfd, 0xa2, 0x42, 0x9a, 0x6c, 0x5a, 0xd6, 0x19, 0x0f, 0xa0, 0x07, 0x97,
+    0x9b, 0xb6, 0xc8, 0x5e, 0x8e, 0x17, 0x55, 0x11, 0x10, 0x16, 0x79, 0x75, 0x1c, 0x38, 0xb6, 0x42,
+    0x33, 0xb1, 0x27, 0x9c, 0xcb, 0xe3, 0xc7, 0x11, 0xf0, 0x97, 0x29, 0xcc, 0x87, 0xac, 0x2a, 0xad,
+    0x09, 0x25, 0x3c, 0x52, 0x4c, 0x66, 0x4c, 0x67, 0x3a, 0xc5, 0x28, 0xec, 0x35, 0xb7, 0xb1, 0x57,
+    0x45, 0x9b, 0x98, 0x15, 0xb1, 0xf7, 0x85, 0xcc, 0x5d, 0xf0, 0xde, 0x28, 0x64, 0x2d, 0x0a, 0x67,
+    0x81, 0xbf, 0x78, 0x22, 0x5f, 0x8b, 0x00, 0x11, 0xe3, 0xef, 0xfc, 0xe4, 0x5f, 0xe7, 0x3c, 0x74,
+    0x46, 0xcb, 0x6a, 0x94, 0xf0, 0xf4, 0x4c, 0xed, 0xc8, 0xf5, 0xbe, 0x2a, 0x71, 0xad, 0xc9, 0xae,
+    0x6f, 0x47, 0xd9, 0x4a, 0xe2, 0x5b, 0xc2, 0x2d, 0x9a, 0x6b, 0x58, 0xd7, 0xad, 0x12, 0x6d, 0xf2,
+    0x35, 0xda, 0x64, 0xc3, 0x5c, 0xb7, 0x4a, 0x69, 0xf4, 0x2d, 0xe2, 0xf9, 0x1e, 0xdb, 0xe8, 0xa9,
+    0x07, 0x2a, 0x21, 0x6b, 0x1e, 0x70, 0x8c, 0x06, 0x33, 0xdf, 0x59, 0xdf, 0x72, 0x18, 0x40, 0xb4,
+    0x75, 0xa4, 0xa6, 0xd5, 0x00, 0x82, 0xde, 0xcb, 0x09, 0xa3, 0x9c, 0x55, 0x24, 0xdc, 0xc8, 0x0f,
+    0xa6, 0x30, 0xd8, 0x90, 0x83, 0x1b, 0xb2, 0xc1, 0x5a, 0xba, 0x2a, 0xaf, 0x47, 0xc3, 0x58, 0xaa,
+    0xfb, 0x6b, 0x16, 0x2e, 0x34, 0x0d, 0x8c, 0x40, 0x60, 0x69, 0x14, 0xc6, 0x88, 0x66, 0x73, 0x8b,
+    0x75, 0x99, 0xde, 0xdc, 0x1e, 0x33, 0x45, 0x29, 0x19, 0xc2, 0xdf, 0x6b, 0x3c, 0x2b, 0xc1, 0xde,
+    0x58, 0x8f, 0x40, 0xa9, 0x3e, 0xeb, 0x51, 0xac, 0x2b, 0xd4, 0x67, 0xc3, 0x04, 0x5d, 0x6e, 0xe2,
+    0xad, 0x45, 0xc1, 0xb9, 0xee, 0x55, 0xe6, 0x12, 0x19, 0xb7, 0xe4, 0x23, 0xc6, 0x87, 0x0f, 0xa5,
+    0xc6, 0xec, 0xa1, 0xac, 0xc7, 0x25, 0x8b, 0x99, 0x1d, 0xb3, 0x40, 0x52, 0x1b, 0x6d, 0x44, 0xd6,
+    0x12, 0x95, 0xc8, 0xd3, 0x50, 0xc6, 0xc5, 0x4b, 0x01, 0x62, 0x51, 0x29, 0xed, 0x88, 0x31, 0x2e,
+    0xbb, 0x36, 0xa1, 0x7a, 0x12, 0x8b, 0xf9, 0x32, 0xad, 0x00, 0xad, 0x70, 0xbf, 0x5d, 0x93, 0x69,
+    0x54, 0xd0, 0x6d, 0x42, 0xf5, 0x24, 0x0e, 0xf3, 0x05, 0x60, 0x01, 0xda, 0xa8, 0x04, 0x8e, 0xa2,
+    0xe3, 0xd6, 0xf4, 0x86, 0x81, 0x64, 0xcf, 0xdc, 0x97, 0xa1, 0xa4, 0xb1, 0x16, 0x4a, 0x76, 0x2b,
+    0xdc, 0xd6, 0x19, 0x16, 0xa9, 0xbd, 0xb9, 0xbf, 0x0f, 0x49, 0x33, 0xf9, 0x55, 0x37, 0xeb, 0xfb,
+    0xe5, 0xa7, 0x39, 0x8a, 0x12, 0xaf, 0xbe, 0x5f, 0x73, 0xc3, 0x6c, 0xa9, 0x84, 0x99, 0xfa, 0xe9,
+    0x05, 0xc4, 0xde, 0xd3, 0x0b, 0x08, 0x81, 0x1a, 0xc6, 0xa3, 0x14, 0x33, 0x0c, 0x18, 0xfd, 0x54,
+    0xc5, 0x01, 0xad, 0x46, 0xbe, 0x46, 0x7d, 0x51, 0xd7, 0x8d, 0x0e, 0x27, 0x6a, 0x94, 0x91, 0x29,
+    0x3a, 0xf4, 0x67, 0x6a, 0xf9, 0xf0, 0x8c, 0xc0, 0x9f, 0xd3, 0xd6, 0xda, 0x59, 0x68, 0x93, 0xec,
+    0x0f, 0xff, 0x93, 0xea, 0x7e, 0x9b, 0x96, 0xe2, 0x7c, 0x04, 0xe1, 0x89, 0x70, 0xdf, 0x85, 0x02,
+    0x68, 0x63, 0xb5, 0xb9, 0x92, 0x87, 0xc6, 0x5a, 0x74, 0x6a, 0x3c, 0xaa, 0xc9, 0x53, 0xed, 0x8b,
+    0x23, 0x3c, 0x87, 0x44, 0x27, 0x4a, 0xdb, 0xb9, 0x47, 0x89, 0x70, 0xde, 0x36, 0x12, 0x2c, 0x46,
+    0x7a, 0xc2, 0x3c, 0x9a, 0x34, 0x8e, 0xff, 0xf5, 0xcf, 0x7f, 0xfc, 0x9d, 0xe8, 0x4e, 0xa6, 0x30,
+    0x97, 0x6a, 0x47, 0xc5, 0x94, 0x14, 0x69, 0x19, 0x6c, 0x05, 0x70, 0xb2, 0x5a, 0x52, 0xe0, 0x54,
+    0xd8, 0xb4, 0x7c, 0xd1, 0x00, 0x0a, 0xe0, 0xa8, 0x22, 0xc8, 0xc1, 0x13, 0x19, 0x2f, 0x0d, 0xe2,
+    0x7b, 0x96, 0xeb, 0x58, 0x9f, 0x04, 0xcd, 0x91, 0x13, 0x4c, 0xe5, 0x7e, 0x4a, 0x65, 0x23, 0x3a,
+    0x73, 0x1f, 0xd5, 0xe4, 0x82, 0xa7, 0xe0, 0x16, 0x81, 0x2e, 0x83, 0x3a, 0x0c, 0x9c, 0xf1, 0x98,
+    0x05, 0x27, 0x38, 0x8c, 0x98, 0xc5, 0x43, 0x31, 0xe2, 0xa3, 0x1a, 0x6c, 0xef, 0x8b, 0x6c, 0x5a,
+    0x98, 0xb8, 0x86, 0xb1, 0x60, 0x2a, 0xd8, 0x0a, 0xa6, 0xcf, 0xd9, 0x6d, 0x01, 0xd2, 0x53, 0x87,
+    0x53, 0x89, 0x57, 0x3e, 0xfd, 0x1f, 0xed, 0xf7, 0xbd, 0xef, 0xda, 0xc8, 0x18, 0xfe, 0xfd, 0x8c,
+    0x3b, 0xbe, 0x66, 0xd6, 0xd2, 0x72, 0x19, 0x62, 0x8e, 0x1e, 0x9f, 0xb7, 0x67, 0xc7, 0x6e, 0x1b,
+    0x51, 0x3a, 0x97, 0x21, 0xc6, 0x88, 0xe9, 0xe7, 0x53, 0x8f, 0x71, 0xdc, 0xa7, 0x23, 0xa6, 0xc1,
+    0x14, 0x0d, 0xfd, 0x2f, 0xdd, 0xab, 0x40, 0x44, 0xbd, 0x19, 0xf3, 0x3a, 0x38, 0xc5, 0x51, 0x4a,
+    0xf8, 0x46, 0xe4, 0xeb, 0x67, 0x54, 0x43, 0xc7, 0xf5, 0x39, 0x4b, 0x89, 0x88, 0xd7, 0xad, 0x54,
+    0x3e, 0x8b, 0x0d, 0x22, 0x0a, 0x41, 0x88, 0x34, 0x5a, 0x05, 0x08, 0xb7, 0xec, 0x86, 0x88, 0x3a,
+    0x79, 0x7d, 0x4f, 0x5d, 0x1c, 0x2e, 0x35, 0x20, 0x29, 0xc1, 0x8e, 0x5e, 0x3d, 0x5b, 0x58, 0x5b,
+    0xd1, 0x57, 0x11, 0x7f, 0xf5, 0xbf, 0x26, 0xa6, 0xe6, 0x17, 0x11, 0x53, 0xf3, 0xcb, 0x8a, 0xa9,
+    0xf9, 0x9f, 0x89, 0x09, 0xbd, 0x5b, 0xd6, 0x99, 0x5b, 0x9c, 0x5b, 0x9a, 0x2c, 0x11, 0xf6, 0x6b,
+    0x17, 0x7b, 0x79, 0x91, 0xd3, 0x27, 0xc4, 0xa0, 0x0c, 0x11, 0xa4, 0x58, 0x31, 0x25, 0xdf, 0xf3,
+    0xb0, 0xc3, 0xe0, 0x8d, 0x49, 0xe8, 0x63, 0xd9, 0x62, 0x9a, 0xa6, 0x8a, 0x3d, 0xc6, 0x96, 0xaf,
+    0xb5, 0x20, 0x04, 0x2d, 0x39, 0x9c, 0xe1, 0x61, 0xca, 0x65, 0xd9, 0x35, 0x59, 0x6e, 0x8e, 0xb8,
+    0x15, 0x38, 0xb3, 0x30, 0x45, 0x56, 0xab, 0x91, 0x37, 0x8e, 0x47, 0x83, 0x25, 0xf9, 0x95, 0x0d,
+    0xfb, 0xbe, 0xf5, 0x89, 0x85, 0x24, 0x8a, 0x49, 0xd8, 0x50, 0x07, 0x66, 0x5c, 0x52, 0xe2, 0x8c,
+    0x11, 0x07, 0x14, 0x30, 0xb7, 0x59, 0x0d, 0x58, 0xb2, 0xfc, 0xe9, 0x94, 0x7a, 0x36, 0x37, 0x27,
+    0x65, 0x33, 0x8b, 0xa8, 0x13, 0x8d, 0x13, 0x1a, 0x30, 0xf2, 0x31, 0x82, 0xaa, 0x10, 0xce, 0x7e,
+    0xaf, 0xc0, 0xd0, 0xb8, 0x21, 0x7e, 0x37, 0x6f, 0x0f, 0x09, 0x54, 0x5c, 0x02, 0x28, 0xbb, 0x58,
+    0x81, 0x97, 0x7b, 0xaa, 0x48, 0x23, 0x68, 0x44, 0x7f, 0x41, 0xdd, 0x23, 0x97, 0x8e, 0xf9, 0x6d,
+    0x4a, 0x16, 0x78, 0xe5, 0x21, 0xe9, 0x5c, 0x9e, 0x92, 0x36, 0x79, 0x24, 0x57, 0xe7, 0xdd, 0x77,
+    0x2d, 0xec, 0xaf, 0x5d, 0x9c, 0xdc, 0x74, 0x3b, 0xef, 0xa1, 0x0a, 0xab, 0x90, 0x93, 0x37, 0xbd,
+    0xeb, 0x01, 0x9c, 0x8b, 0x2b, 0xa4, 0x73, 0x71, 0x72, 0x79, 0xd5, 0xff, 0xad, 0x77, 0x75, 0xd6,
+    0x85, 0xfa, 0x33, 0x79, 0xef, 0x5c, 0xf4, 0xfa, 0x67, 0x2d, 0xf2, 0x3a, 0x19, 0xe8, 0xde, 0x9c,
+    0xbe, 0x83, 0x01, 0xa8, 0xe2, 0xdf, 0xf7, 0x2e, 0x4e, 0xa1, 0xc6, 0xab, 0x90, 0xeb, 0xb3, 0xce,
+    0x87, 0xce, 0x05, 0x0c, 0xfe, 0x00, 0x08, 0xaf, 0x2f, 0x5b, 0xe4, 0xa0, 0x42, 0x4e, 0xcf, 0xfb,
+    0xe2, 0xf1, 0x47, 0xb2, 0x3a, 0x54, 0xf8, 0x39, 0xe9, 0xfc, 0xfc, 0x5b, 0x7f, 0x70, 0x32, 0xb8,
+    0xe9, 0x03, 0x5b, 0x1f, 0x8d, 0xde, 0xcf, 0x46, 0x85, 0x18, 0x6f, 0xa0, 0x2e, 0x1b, 0x05, 0x74,
+    0xca, 0xf0, 0xe5, 0xc6, 0xfb, 0xe4, 0xf9, 0x0b, 0x30, 0x72, 0xb9, 0x6b, 0x1c, 0xea, 0xfa, 0x21,
+    0x01, 0x75, 0xfa, 0x0b, 0x66, 0x13, 0x98, 0xc3, 0x21, 0x2c, 0xe5, 0x86, 0x73, 0xbe, 0x94, 0xd3,
+    0xc4, 0x19, 0x7b, 0x4e, 0x08, 0x27, 0x28, 0x54, 0x90, 0xe3, 0xcd, 0x9d, 0x70, 0x69, 0xdc, 0xa6,
+    0xa4, 0xdd, 0x54, 0x75, 0x91, 0x22, 0xdb, 0xe0, 0x3d, 0xae, 0xab, 0x42, 0x08, 0x82, 0x7d, 0xf6,
+    0x3b, 0x4c, 0xd7, 0x55, 0xc6, 0x21, 0x0b, 0x60, 0x9d, 0x9c, 0x68, 0x12, 0x30, 0xb0, 0x05, 0xb9,
+    0xa4, 0xb3, 0x52, 0xf9, 0x10, 0xb5, 0x04, 0xba, 0x21, 0xd5, 0x63, 0x90, 0x34, 0x67, 0x5e, 0x78,
+    0x12, 0x56, 0xc0, 0x2f, 0x4f, 0xac, 0x4f, 0xd9, 0x13, 0xc0, 0x08, 0x92, 0x25, 0xb6, 0x4d, 0x10,
+    0x21, 0x5a, 0x72, 0x27, 0xcb, 0x51, 0xa9, 0xac, 0x9c, 0x08, 0x9c, 0x11, 0x29, 0x7d, 0xb5, 0x70,
+    0x3c, 0xdb, 0x5f, 0x98, 0x89, 0x01, 0x96, 0x49, 0xc0, 0xc2, 0x79, 0xe0, 0xa9, 0xf5, 0x3e, 0x32,
+    0xc8, 0x93, 0x9d, 0x01, 0x5f, 0xc9, 0x8a, 0xd2, 0xdd, 0x82, 0xb7, 0x6a, 0xb5, 0x97, 0x8f, 0xae,
+    0x6f, 0x51, 0xa4, 0x6e, 0x4e, 0x7c, 0x1e, 0xae, 0x6a, 0x0b, 0x7e, 0xa7, 0x94, 0xef, 0x72, 0xbd,
+    0x39, 0x14, 0x36, 0x3f, 0x58, 0xce, 0x18, 0xa0, 0x32, 0x68, 0x10, 0xd0, 0xe5, 0x70, 0x3e, 0x1a,
+    0x41, 0x5d, 0xad, 0x05, 0xf7, 0xbd, 0x29, 0xe3, 0x9c, 0x8e, 0x11, 0xba, 0xc4, 0xee, 0x61, 0xef,
+    0x65, 0xd2, 0x3e, 0x56, 0xf6, 0x92, 0x32, 0x09, 0xf6, 0x1d, 0x71, 0x78, 0xe3, 0x78, 0xe1, 0xc1,
+    0x09, 0xa2, 0x97, 0xcb, 0x4c, 0x9b, 0x86, 0x54, 0x61, 0x69, 0x4d, 0xfa, 0xb0, 0x56, 0xd1, 0x83,
+    0x39, 0x86, 0x3d, 0x02, 0xd6, 0x8f, 0x8d, 0x5b, 0xcd, 0x62, 0x21, 0xc4, 0x68, 0x85, 0x5e, 0x76,
+    0xe2, 0x08, 0xa4, 0xa0, 0xb4, 0x19, 0x98, 0x03, 0x2b, 0xc6, 0x1a, 0xc1, 0x9b, 0x42, 0xc3, 0x08,
+    0x56, 0x81, 0xa1, 0x00, 0xdb, 0x30, 0xd4, 0xb3, 0x98, 0x09, 0x16, 0x0a, 0xda, 0xac, 0x26, 0x60,
+    0xd2, 0x20, 0x14, 0x3c, 0xab, 0x02, 0x69, 0x5a, 0xa2, 0x10, 0x00, 0x59, 0x16, 0x8b, 0x71, 0x83,
+    0x19, 0x17, 0xed, 0x08, 0xaa, 0x3c, 0x38, 0x6a, 0x69, 0xb6, 0xc2, 0x59, 0x38, 0x70, 0xa6, 0xcc,
+    0x9f, 0x87, 0x25, 0x9d, 0x55, 0xc2, 0x91, 0xbd, 0x5e, 0xaf, 0xef, 0xc8, 0xba, 0x8f, 0x85, 0xd2,
+    0xee, 0x9c, 0xcb, 0x75, 0x85, 0xa8, 0x57, 0x59, 0xff, 0xd3, 0xb8, 0xcb, 0xe1, 0x8b, 0x6c, 0x8c,
+    0xec, 0x33, 0xf4, 0x49, 0xd1, 0x44, 0x09, 0x27, 0x2c, 0x13, 0xb1, 0x17, 0x13, 0x60, 0xca, 0x09,
+    0x89, 0x03, 0xb3, 0xc0, 0xdf, 0x61, 0x64, 0x04, 0x9c, 0x8c, 0xa8, 0x0b, 0x82, 0x86, 0x4c, 0x02,
+    0x0f, 0xae, 0x38, 0xea, 0xe2, 0xcb, 0xfb, 0xc1, 0xe0, 0xca, 0x5c, 0xf7, 0x58, 0x50, 0xa1, 0x2d,
+    0x11, 0x46, 0x22, 0x2d, 0x25, 0x31, 0x59, 0x18, 0x81, 0xd6, 0x79, 0xf3, 0x1b, 0xfe, 0xe3, 0x8f,
+    0xbc, 0x04, 0xcc, 0x00, 0x8e, 0xb3, 0xcb, 0x3e, 0xa6, 0x3c, 0xf2, 0x55, 0xbb, 0x9d, 0xb2, 0x6c,
+    0x62, 0x14, 0x8e, 0x8d, 0x55, 0xb2, 0xa9, 0x75, 0x77, 0x11, 0xa6, 0xd2, 0x98, 0xa5, 0xc2, 0x64,
+    0x62, 0x59, 0x29, 0xf3, 0xf6, 0x0a, 0xaa, 0x0e, 0xf2, 0x0d, 0xa9, 0x3f, 0xbc, 0x7d, 0xab, 0xf4,
+    0x01, 0x14, 0x93, 0x01, 0xcb, 0x28, 0x89, 0x7c, 0x13, 0x47, 0xb4, 0xd6, 0xba, 0x91, 0x47, 0xbb,
+    0x6f, 0xc5, 0xb1, 0xae, 0xac, 0x63, 0x14, 0x32, 0x1b, 0x4f, 0x39, 0x35, 0x39, 0x14, 0x2b, 0x50,
+    0xc5, 0x95, 0xf1, 0xb2, 0x01, 0x22, 0x52, 0xe9, 0x23, 0xde, 0xf9, 0xdc, 0xae, 0xaf, 0xcc, 0x48,
+    0x0a, 0xa5, 0x5f, 0x52, 0x62, 0x46, 0x9c, 0x14, 0x3f, 0xd6, 0x6f, 0xd3, 0x3c, 0xca, 0xe1, 0x2d,
+    0xda, 0x5c, 0xf4, 0xde, 0x88, 0xdf, 0x6f, 0xcb, 0x0a, 0x89, 0x48, 0xbe, 0x61, 0x30, 0x67, 0xda,
+    0x7e, 0x0d, 0x18, 0xd5, 0x5d, 0x44, 0xe3, 0x8e, 0x94, 0xd2, 0x1c, 0x9c, 0x49, 0xd7, 0x65, 0xb4,
+    0x2a, 0x14, 0x4e, 0x91, 0xe1, 0x65, 0x91, 0x45, 0x56, 0xcc, 0xec, 0x43, 0xe2, 0x03, 0x64, 0xb0,
+    0x70, 0xd0, 0xfc, 0x60, 0x09, 0x9a, 0x1c, 0xb9, 0x83, 0x2d, 0x8a, 0x6e, 0xfb, 0x1d, 0xe2, 0x0c,
+    0xd8, 0xef, 0x73, 0x06, 0x15, 0x8b, 0x5d, 0x60, 0x8a, 0xb1, 0x11, 0xc6, 0x8b, 0xe2, 0xa2, 0xe0,
+    0xcc, 0x65, 0x53, 0x60, 0xe7, 0x1c, 0x4b, 0x85, 0xb9, 0x65, 0x41, 0x60, 0xbe, 0x94, 0xc1, 0xb9,
+    0x42, 0x9c, 0xe9, 0x94, 0xd9, 0x0e, 0x18, 0x5b, 0x3f, 0x2e, 0x1f, 0x24, 0x0e, 0xd5, 0x72, 0x23,
+    0xe3, 0x8a, 0xd0, 0x81, 0xde, 0x6c, 0xdf, 0x9a, 0x23, 0x52, 0x0c, 0xb4, 0x11, 0xfe, 0x37, 0xcb,
+    0x73, 0xbb, 0xa4, 0xd6, 0x58, 0x5a, 0xdd, 0xf3, 0x19, 0xb3, 0x9c, 0x91, 0x63, 0xf5, 0xb7, 0xe3,
+    0x53, 0x76, 0x90, 0xf5, 0xef, 0xd8, 0xa3, 0x94, 0x3d, 0x90, 0x6f, 0xbe, 0x59, 0x23, 0x50, 0xd6,
+    0x04, 0x1e, 0x15, 0xc6, 0x74, 0x40, 0x13, 0xc1, 0x80, 0x3d, 0x60, 0x14, 0x52, 0x70, 0x2a, 0xe1,
+    0x68, 0x8d, 0x05, 0x9e, 0xd0, 0xe1, 0x3a, 0x6c, 0x46, 0x3f, 0xca, 0x53, 0x91, 0x06, 0xa1, 0x44,
+    0x35, 0x94, 0x8d, 0xc4, 0xde, 0xeb, 0x85, 0x3d, 0x10, 0x60, 0x12, 0x0d, 0x23, 0x75, 0x88, 0x3d,
+    0x15, 0x07, 0x1b, 0x99, 0x6c, 0x82, 0x70, 0x73, 0x92, 0x8d, 0x3a, 0x8c, 0xed, 0x4c, 0xb1, 0xf5,
+    0x11, 0x93, 0x59, 0xf3, 0xf6, 0x16, 0xc3, 0x90, 0x71, 0x16, 0x04, 0xbe, 0x9a, 0xce, 0x33, 0xa9,
+    0xd6, 0x97, 0xb7, 0x3b, 0xb0, 0xfe, 0xee, 0xca, 0x8f, 0x6f, 0x7a, 0x4a, 0x2f, 0x1f, 0x11, 0xc5,
+    0xde, 0xed, 0xaa, 0x42, 0xe4, 0xe3, 0xeb, 0xdb, 0x55, 0xf9, 0x4e, 0x9f, 0x72, 0xb7, 0x48, 0xe9,
+    0x0e, 0x8a, 0xb7, 0x16, 0x60, 0x91, 0x93, 0x2b, 0xc4, 0x0d, 0x5b, 0x32, 0x43, 0xff, 0xad, 0xf3,
+    0xc0, 0x6c, 0x88, 0x0d, 0x2b, 0x32, 0xe5, 0x85, 0xb8, 0x77, 0xd0, 0xf8, 0x56, 0xad, 0x4b, 0x69,
+    0x88, 0xb8, 0x5b, 0x27, 0x3f, 0xc5, 0x02, 0x83, 0x5d, 0xe6, 0xdd, 0x06, 0xa7, 0xf2, 0x03, 0xad,
+    0x44, 0x3c, 0x9a, 0x64, 0x9a, 0x37, 0x17, 0x35, 0x1a, 0x0a, 0xe6, 0x73, 0x6a, 0x4f, 0x2b, 0x92,
+    0x7c, 0xb7, 0x97, 0x85, 0xd6, 0x24, 0xf1, 0xed, 0xf2, 0x1a, 0x19, 0x13, 0xa2, 0x86, 0x57, 0x0a,
+    0x18, 0x9f, 0x81, 0xbe, 0x98, 0xde, 0x10, 0x92, 0x24, 0x14, 0x83, 0x99, 0x3e, 0x24, 0xa9, 0x70,
+    0x82, 0xf7, 0xa7, 0x18, 0x49, 0x85, 0x09, 0x94, 0x8c, 0x2e, 0x0b, 0x17, 0x7e, 0x00, 0x01, 0xdc,
+    0x80, 0xc4, 0x90, 0x80, 0x4a, 0x71, 0xa0, 0xa8, 0x34, 0x9b, 0xcc, 0xc4, 0xce, 0x64, 0x01, 0x36,
+    0x97, 0x75, 0xd5, 0xc5, 0xaa, 0x88, 0xf9, 0x50, 0xa8, 0x61, 0x13, 0xe3, 0xdb, 0x1d, 0x2d, 0xb8,
+    0xc7, 0x66, 0x32, 0x32, 0x8e, 0xd8, 0x0e, 0x8b, 0x31, 0xed, 0x68, 0x30, 0x51, 0x9c, 0x3e, 0x1f,
+    0x11, 0x2a, 0x68, 0x3a, 0x96, 0xaa, 0x7c, 0x88, 0xcc, 0xb3, 0xc0, 0xbf, 0x77, 0x6c, 0x06, 0xae,
+    0x38, 0x07, 0xd1, 0x3b, 0xa1, 0x49, 0x36, 0xe1, 0xea, 0xc5, 0x81, 0x5e, 0x82, 0x63, 0xb4, 0x17,
+    0x3b, 0x0f, 0x98, 0xc5, 0x9c, 0x7b, 0x86, 0x87, 0x1e, 0x7f, 0x2a, 0x86, 0xb9, 0xd8, 0x0e, 0xa1,
+    0x5c, 0xbe, 0x09, 0x56, 0xcd, 0x42, 0xd4, 0x1b, 0x6d, 0x7b, 0xbb, 0x09, 0x17, 0xcb, 0x6b, 0xb5,
+    0x93, 0x0a, 0x21, 0x6d, 0xa3, 0x81, 0xa2, 0x09, 0x15, 0x2b, 0x31, 0x51, 0x9b, 0xe8, 0xdf, 0x9b,
+    0xf2, 0x7a, 0x18, 0x14, 0x17, 0x30, 0xdb, 0x38, 0x7c, 0xb6, 0xda, 0x85, 0xdd, 0x4a, 0xad, 0x0b,
+    0xfa, 0x66, 0x74, 0xfa, 0xf8, 0x3c, 0xea, 0x5f, 0x93, 0xeb, 0xce, 0xbc, 0x6f, 0xd5, 0x8a, 0x71,
+    0x22, 0xd3, 0xf7, 0x88, 0x3a, 0x6e, 0x21, 0x96, 0x95, 0x5e, 0x92, 0x69, 0x8d, 0x5e, 0x54, 0x5b,
+    0x6f, 0x11, 0xa1, 0xb2, 0x8d, 0xa2, 0x8b, 0xa1, 0x0d, 0x7b, 0xd3, 0x4b, 0x72, 0x9b, 0xbc, 0xd6,
+    0xee, 0x0b, 0x8b, 0xf6, 0x5d, 0xc1, 0xcb, 0xb9, 0xba, 0x36, 0x82, 0x68, 0x8b, 0xb3, 0xec, 0x51,
+    0x3a, 0x7b, 0x1f, 0xa2, 0x2d, 0x66, 0x72, 0x30, 0x22, 0xd5, 0x8a, 0xf7, 0x92, 0x71, 0x12, 0x30,
+    0xb2, 0xf4, 0xe7, 0xe0, 0x20, 0xd1, 0xc3, 0x82, 0x42, 0x2d, 0x07, 0xa7, 0x00, 0xd9, 0xd7, 0xfe,
+    0xc9, 0xd0, 0x44, 0xf0, 0x1c, 0x32, 0x9d, 0x2d, 0x45, 0x5d, 0xb8, 0x98, 0xa3, 0xa2, 0x82, 0x42,
+    0xb7, 0x19, 0x65, 0xa9, 0x82, 0x3c, 0x5b, 0xf8, 0x19, 0xb5, 0xe8, 0x66, 0xa8, 0x42, 0x94, 0x26,
+    0x3c, 0x0c, 0x74, 0xfc, 0xb9, 0x17, 0xda, 0xd8, 0x42, 0x81, 0xb1, 0x00, 0xaa, 0x48, 0xd1, 0x2f,
+    0x09, 0xd8, 0x8c, 0x06, 0x58, 0x9a, 0x40, 0x09, 0x1f, 0x6d, 0x10, 0xab, 0x93, 0x0a, 0xf9, 0xd8,
+    0xb9, 0x3c, 0x35, 0x65, 0x57, 0xe8, 0x76, 0x8b, 0xb4, 0xb3, 0x37, 0x31, 0x1b, 0xb9, 0xa3, 0xc1,
+    0x54, 0xcb, 0x1a, 0xac, 0x14, 0xec, 0xe0, 0xa9, 0x35, 0xa2, 0x7c, 0x72, 0x7d, 0xb9, 0x23, 0xd9,
+    0xf8, 0xae, 0x66, 0x23, 0x65, 0x5b, 0x00, 0x69, 0x89, 0xe3, 0x3d, 0x44, 0x9e, 0xb6, 0xec, 0x53,
+    0xed, 0x48, 0x5e, 0xde, 0xc7, 0x6c, 0x24, 0x3e, 0x01, 0x10, 0x2d, 0x69, 0x5c, 0x0b, 0xb2, 0xcf,
+    0x53, 0xc7, 0x16, 0xda, 0x8e, 0xb4, 0x93, 0x4b, 0x9b, 0x8d, 0xe4, 0x03, 0x09, 0xa5, 0xe5, 0xe0,
+    0x1a, 0x4f, 0x9b, 0xa9, 0x6d, 0xe7, 0x39, 0x89, 0x7a, 0x78, 0xbb, 0xaa, 0x5f, 0xde, 0x10, 0x6a,
+    0x7d, 0x4d, 0x62, 0xdf, 0xa1, 0xdc, 0x57, 0x38, 0xd4, 0x78, 0x5a, 0x1e, 0x55, 0x59, 0x41, 0xad,
+    0x04, 0x57, 0xec, 0x64, 0x9e, 0x77, 0xdf, 0xc9, 0x7a, 0x7b, 0x83, 0x5d, 0x8a, 0x3b, 0x4f, 0xad,
+    0x65, 0xe2, 0x0c, 0xb3, 0xbf, 0x52, 0x8c, 0x13, 0xf1, 0xee, 0x28, 0x96, 0xdc, 0x8d, 0xce, 0x46,
+    0x3d, 0x89, 0x8e, 0x2d, 0xaf, 0x89, 0x56, 0x0f, 0xd2, 0xce, 0x35, 0xda, 0xd1, 0x81, 0xb3, 0x3d,
+    0x75, 0x39, 0x00, 0x45, 0x27, 0xb8, 0xae, 0x9c, 0xc8, 0xb8, 0x6d, 0xb6, 0x4f, 0xbb, 0x23, 0x9b,
+    0xd9, 0xcb, 0xad, 0x5d, 0xb8, 0xc4, 0xae, 0xc9, 0x06, 0x26, 0x7b, 0xd1, 0x34, 0xfe, 0xdd, 0xc4,
+    0x22, 0x36, 0x35, 0x0a, 0x38, 0xac, 0x7d, 0xf7, 0x5d, 0xca, 0xc6, 0x77, 0xa4, 0x7b, 0xf6, 0x6b,
+    0x8b, 0xbc, 0x4d, 0xb8, 0xf6, 0x63, 0xc6, 0xb3, 0xb7, 0x1e, 0x59, 0xf8, 0x3f, 0x43, 0x5c, 0xa3,
+    0x53, 0xf2, 0xe8, 0xcd, 0xa7, 0x43, 0x16, 0xac, 0x24, 0x58, 0x77, 0x3e, 0x25, 0x55, 0x32, 0x80,
+    0x5a, 0x4a, 0xae, 0x02, 0x34, 0xf2, 0xe3, 0xae, 0x52, 0x83, 0x40, 0xfc, 0x6b, 0x96, 0x37, 0x61,
+    0x48, 0x3e, 0x65, 0x8c, 0x50, 0xa4, 0xef, 0x29, 0x9a, 0x6a, 0x43, 0x04, 0x52, 0x0c, 0xb3, 0x90,
+    0xbc, 0xc4, 0xf3, 0x7c, 0x96, 0xc5, 0x5a, 0x2b, 0xd4, 0x80, 0xbc, 0xa0, 0x89, 0xd9, 0xac, 0xa4,
+    0xe8, 0xf5, 0x2e, 0x15, 0x1f, 0x04, 0xf0, 0xe0, 0x14, 0x2b, 0x45, 0x30, 0xf1, 0x93, 0x78, 0x79,
+    0xf9, 0x18, 0x63, 0x5a, 0xb5, 0x5f, 0x3e, 0x26, 0xb8, 0x56, 0xca, 0xf1, 0x09, 0xaa, 0xd1, 0x41,
+    0x52, 0x67, 0x7e, 0xcb, 0x93, 0xda, 0x9d, 0x2c, 0x1c, 0xd7, 0x25, 0xd1, 0xc7, 0x13, 0xa2, 0xf8,
+    0xc4, 0xe3, 0x41, 0x7c, 0xc8, 0xa9, 0x10, 0xee, 0x93, 0x05, 0x23, 0x33, 0xca, 0xb9, 0xf0, 0x0b,
+    0xa2, 0x22, 0xc5, 0x8d, 0x8b, 0x92, 0x35, 0x5f, 0x64, 0xd2, 0x60, 0x2c, 0xdc, 0x5e, 0x44, 0x1c,
+    0x16, 0x66, 0x4d, 0x2b, 0x29, 0x85, 0x13, 0x16, 0x44, 0x4d, 0x2c, 0x39, 0x77, 0x97, 0xa6, 0x36,
+    0x83, 0xcb, 0x95, 0xed, 0x54, 0xb9, 0x6d, 0x38, 0xba, 0x35, 0xa0, 0xb8, 0xcd, 0xda, 0x98, 0xb8,
+    0x9d, 0xc8, 0xc8, 0x13, 0x1b, 0x4b, 0x50, 0xee, 0x6a, 0x40, 0xea, 0x19, 0xa8, 0xdb, 0xe2, 0x80,
+    0x91, 0xf6, 0x57, 0x54, 0xf3, 0x97, 0x31, 0xe2, 0x0e, 0x55, 0x99, 0x58, 0x3d, 0xc9, 0xa8, 0x02,
+    0x1c, 0xe0, 0x2e, 0xed, 0xb1, 0x14, 0x35, 0x98, 0x84, 0x7d, 0x26, 0xd9, 0x1a, 0x1b, 0x3f, 0x73,
+    0x8f, 0x0c, 0x97, 0x42, 0x3a, 0x58, 0x65, 0x2c, 0x68, 0xc0, 0x0e, 0xc5, 0xdb, 0x0c, 0x85, 0xea,
+    0x7b, 0xee, 0x32, 0xfe, 0xde, 0x95, 0xc3, 0xe1, 0x83, 0x83, 0x38, 0xe0, 0x20, 0xa9, 0x69, 0x12,
+    0x89, 0x36, 0x5d, 0xd8, 0xc1, 0xd9, 0x12, 0x1c, 0xa5, 0x15, 0xbb, 0x8a, 0x8e, 0x6f, 0x30, 0x43,
+    0x8e, 0xc4, 0xf9, 0xd7, 0x18, 0x54, 0x0d, 0x10, 0x94, 0x31, 0x78, 0x65, 0x94, 0xa1, 0xb2, 0x2e,
+    0x5d, 0xd2, 0x70, 0x62, 0xd2, 0x21, 0x17, 0x6b, 0x6b, 0xb2, 0x36, 0xcb, 0x1c, 0xcf, 0x01, 0xc4,
+    0x20, 0xdc, 0xd8, 0x1c, 0x6e, 0xf8, 0xc4, 0x5f, 0xc8, 0x4a, 0xe6, 0x6a, 0x42, 0x39, 0x13, 0x65,
+    0x29, 0xfb, 0xa2, 0x49, 0x83, 0x2f, 0x1c, 0x38, 0x97, 0xc8, 0x02, 0x98, 0x99, 0x33, 0xa4, 0xaa,
+    0x2b, 0xd0, 0x2c, 0x18, 0x87, 0xf0, 0xd5, 0xbb, 0xe9, 0x0e, 0x4e, 0x7b, 0xbf, 0x76, 0x8d, 0xd6,
+    0xa6, 0xcc, 0x92, 0x15, 0xa4, 0xc4, 0x0b, 0x67, 0x62, 0xf9, 0xa9, 0xd7, 0x61, 0x01, 0x66, 0x4c,
+    0xeb, 0x9b, 0x91, 0x0a, 0x10, 0x42, 0x43, 0x71, 0x8c, 0x79, 0x06, 0x85, 0xf3, 0x77, 0xdd, 0xf3,
+    0xc1, 0x79, 0x6f, 0x0b, 0xeb, 0x09, 0xd8, 0x73, 0xc9, 0x08, 0x97, 0xf9, 0xed, 0xfa, 0xec, 0xe2,
+    0xec, 0xa4, 0x7f, 0xb6, 0x85, 0x56, 0x94, 0x0d, 0x02, 0xe6, 0xe2, 0x77, 0xbe, 0xf6, 0xb3, 0x49,
+    0xf6, 0x2e, 0xaf, 0x2e, 0xce, 0x06, 0xdb, 0xa8, 0x45, 0xa5, 0x3c, 0xb8, 0xd7, 0x0c, 0x6f, 0x6a,
+    0x8c, 0x2d, 0x58, 0x45, 0x16, 0xdf, 0x82, 0x32, 0xc9, 0xff, 0x85, 0xb8, 0x6c, 0x36, 0xa2, 0x73,
+    0x37, 0x6c, 0xc5, 0x4d, 0x1b, 0x71, 0xed, 0x70, 0xf2, 0xf6, 0xac, 0x06, 0x25, 0xe4, 0xd9, 0x29,
+    0x60, 0x67, 0xf4, 0x5e, 0x06, 0x36, 0x97, 0xa6, 0x31, 0x0b, 0x42, 0xad, 0xb4, 0xd6, 0xed, 0xe7,
+    0x00, 0xc0, 0x77, 0x81, 0x9f, 0xf8, 0xce, 0xa8, 0x2d, 0xd6, 0xc0, 0xd3, 0x9c, 0x4f, 0x40, 0x98,
+    0x4a, 0x44, 0x10, 0xad, 0x65, 0x86, 0xed, 0x02, 0x27, 0x14, 0x37, 0xd1, 0x63, 0xc6, 0x35, 0xfe,
+    0x37, 0x1f, 0xe2, 0x8d, 0xf6, 0x90, 0x0d, 0xfc, 0x2b, 0x6a, 0x8b, 0x7b, 0x86, 0x82, 0x9a, 0x6d,
+    0x16, 0x4d, 0x6f, 0x76, 0xbd, 0xf4, 0x82, 0x5e, 0x53, 0xab, 0xc5, 0x17, 0x95, 0x67, 0x78, 0x93,
+    0xd7, 0xf7, 0xe7, 0x81, 0xa5, 0x75, 0xbd, 0x94, 0x92, 0xa2, 0x4f, 0xdc, 0xb6, 0xdc, 0xb2, 0xe7,
+    0x43, 0xb2, 0x98, 0xcf, 0x66, 0x42, 0x1b, 0x72, 0xe7, 0x10, 0x17, 0x87, 0x81, 0xbf, 0xe0, 0x4c,
+    0xd7, 0xb3, 0xd4, 0xdd, 0xe9, 0xad, 0xb4, 0xb7, 0xa3, 0xc8, 0x54, 0x74, 0xf7, 0x98, 0x61, 0x13,
+    0x0a, 0x1d, 0x71, 0xfd, 0xb8, 0x1e, 0x4d, 0xc4, 0xf4, 0x53, 0xef, 0x37, 0xe5, 0x26, 0xda, 0xe4,
+    0x2f, 0xfd, 0x5e, 0xd7, 0x9c, 0xe1, 0xff, 0x75, 0xb7, 0xcb, 0xed, 0x66, 0x7c, 0x7b, 0xdd, 0x96,
+    0xeb, 0x4d, 0xd0, 0x34, 0x66, 0x15, 0x08, 0xcc, 0x6f, 0xcf, 0xaf, 0xa1, 0xac, 0x35, 0x44, 0x6b,
+    0x52, 0x4c, 0x51, 0x3c, 0x41, 0xe1, 0x8c, 0x3c, 0x4a, 0x61, 0xd4, 0x16, 0xe7, 0x1a, 0xdd, 0xdd,
+    0x9e, 0x36, 0x02, 0x17, 0xf1, 0x90, 0xde, 0x9c, 0x27, 0x6c, 0x64, 0x86, 0x80, 0x60, 0xe6, 0xad,
+    0xf7, 0xb3, 0x20, 0xdc, 0xed, 0x91, 0x4e, 0xaf, 0x0b, 0x75, 0xf7, 0xcd, 0xf9, 0xe0, 0x83, 0x46,
+    0x37, 0x05, 0xea, 0xbe, 0x93, 0x9d, 0xdf, 0x28, 0x44, 0xaf, 0xc8, 0x1f, 0xe4, 0x5c, 0xee, 0x1f,
+    0x7b, 0xc2, 0x91, 0x28, 0x44, 0x97, 0x39, 0xa5, 0x88, 0x40, 0x78, 0xe3, 0xff, 0xf2, 0x31, 0x8e,
+    0xee, 0xd4, 0xbe, 0xbc, 0xd7, 0xa4, 0xa6, 0x15, 0xf9, 0xe5, 0x8e, 0xbc, 0xd2, 0x36, 0x19, 0xee,
+    0x00, 0x87, 0x0c, 0x53, 0x71, 0xef, 0x99, 0xc9, 0x8f, 0xaf, 0x1b, 0x82, 0x58, 0x66, 0xa0, 0xb9,
+    0xda, 0x84, 0xe3, 0xc2, 0xf7, 0x67, 0xf8, 0xe5, 0x70, 0xb2, 0xc6, 0x85, 0x81, 0x4b, 0xfa, 0x70,
+    0xc9, 0xb1, 0x6d, 0x9d, 0xa2, 0xc2, 0xfb, 0x11, 0xc8, 0xe7, 0x30, 0x1a, 0x3f, 0xdd, 0x6d, 0xb9,
+    0x47, 0x8d, 0x0c, 0x2e, 0x6a, 0xac, 0x15, 0x5e, 0xa4, 0x16, 0x79, 0xd1, 0x55, 0x1c, 0x37, 0x30,
+    0x44, 0x59, 0xc9, 0xd7, 0x32, 0xeb, 0x67, 0x22, 0xed, 0x2d, 0xab, 0x36, 0x5e, 0x1c, 0xc6, 0xdf,
+    0xe0, 0x46, 0xdf, 0xc6, 0x1c, 0xd5, 0xe4, 0xc7, 0xb7, 0xf8, 0x35, 0x2e, 0xfe, 0xcf, 0xa7, 0xff,
+    0x06, 0x88, 0x1f, 0xfc, 0x09, 0x8c, 0x3a, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,239 @@
+// LAUNCH SEQUENCER
+//
+// Firmware-side countdown: SAFE -> ARMED -> COUNTDOWN -> IGNITION ->
+// CLAMP RELEASE -> COMPLETE, with HOLD, ABORT and RECYCLE. The countdown
+// only starts with the igniter in circuit, and aborts itself if the igniter
+// drops out before ignition.
+//
+// The sequence clock is T relative to ignition in milliseconds and advances
+// only in LAUNCH_TICK_MS steps, scheduled against millis() rather than
+// against the previous loop iteration. A late loop() runs the missed ticks
+// back to back, so every step still lands on its own tick in the same order;
+// how late the pad actually acted is kept in maxLatenessMs.
+
+#ifndef LAUNCHSEQUENCE_H
+#define LAUNCHSEQUENCE_H
+#include <Arduino.h>
+
+#ifndef LAUNCH_TICK_MS
+#define LAUNCH_TICK_MS 1                // Sequence clock resolution
+#endif
+#define LAUNCH_COUNTDOWN_MS 10000       // Default T-minus at start()
+#define LAUNCH_CLAMP_RELEASE_MS 500     // Default clamp release, relative to ignition
+#define LAUNCH_COMPLETE_MS 3000         // COMPLETE this long after the last step (and clamps at rest)
+
+enum LaunchPhase {
+    PHASE_SAFE,
+    PHASE_ARMED,
+    PHASE_COUNTDOWN,
+    PHASE_HOLD,
+    PHASE_IGNITION,
+    PHASE_CLAMP_RELEASE,
+    PHASE_COMPLETE,
+    PHASE_ABORT,
+    LAUNCH_PHASE_COUNT
+};
+
+const char* const LAUNCH_PHASE_NAMES[LAUNCH_PHASE_COUNT] = {
+    "SAFE", "ARMED", "COUNTDOWN", "HOLD", "IGNITION", "CLAMP_RELEASE", "COMPLETE", "ABORT"
+};
+
+// What the sequence does to the pad. Any of these may be null.
+struct LaunchActions {
+    void (*ignite)();
+    void (*releaseClamps)();
+    void (*safe)();             // Igniter off, clamps closed; on abort and recycle
+    void (*countdownTick)();    // Every whole second of the countdown
+    bool (*clampsMoving)();     // COMPLETE waits until this is false
+    bool (*igniterReady)();     // Igniter in circuit; start() refuses and the countdown aborts without it
+};
+
+class LaunchSequence {
+public:
+    LaunchSequence(LaunchActions actions) {
+        this->actions = actions;
+    }
+
+    // Countdown length and clamp release offset (negative = before ignition).
+    // Both are rounded to whole ticks. Only allowed while SAFE or ARMED.
+    bool configure(long countdownMs, long clampReleaseMs) {
+        if (this->phase != PHASE_SAFE && this->phase != PHASE_ARMED) {
+            return false;
+        }
+        this->countdownMs = roundToTick(max(countdownMs, (long)LAUNCH_TICK_MS));
+        this->clampReleaseMs = roundToTick(constrain(clampReleaseMs, -this->countdownMs, (long)LAUNCH_COMPLETE_MS));
+        return true;
+    }
+
+    bool arm() {
+        if (this->phase != PHASE_SAFE) {
+            return false;
+        }
+        this->phase = PHASE_ARMED;
+        return true;
+    }
+
+    bool disarm() {
+        if (this->phase != PHASE_ARMED) {
+            return false;
+        }
+        this->phase = PHASE_SAFE;
+        return true;
+    }
+
+    // Starts the countdown from ARMED, or resumes it from HOLD. Refused
+    // while the igniter is out of circuit.
+    bool start() {
+        if ((this->phase == PHASE_ARMED || this->phase == PHASE_HOLD) && !igniterReady()) {
+            return false;
+        }
+        if (this->phase == PHASE_ARMED) {
+            this->clockMs = -this->countdownMs;
+            this->ignited = false;
+            this->released = false;
+            this->maxLatenessMs = 0;
+            this->ticks = 0;
+            call(this->actions.countdownTick);
+        }
+        else if (this->phase != PHASE_HOLD) {
+            return false;
+        }
+        this->phase = PHASE_COUNTDOWN;
+        this->nextTick = millis() + LAUNCH_TICK_MS;
+        return true;
+    }
+
+    // Freezes the clock. Only possible before the first irreversible step.
+    bool hold() {
+        if (this->phase != PHASE_COUNTDOWN || this->ignited || this->released) {
+            return false;
+        }
+        this->phase = PHASE_HOLD;
+        return true;
+    }
+
+    // Makes the pad safe. Always runs the safe action, even when idle.
+    void abort() {
+        call(this->actions.safe);
+        if (this->phase != PHASE_SAFE && this->phase != PHASE_ARMED) {
+            this->phase = PHASE_ABORT;
+        }
+    }
+
+    // Back to ARMED for another attempt, from HOLD, ABORT or COMPLETE.
+    bool recycle() {
+        if (this->phase != PHASE_HOLD && this->phase != PHASE_ABORT && this->phase != PHASE_COMPLETE) {
+            return false;
+        }
+        call(this->actions.safe);
+        this->phase = PHASE_ARMED;
+        this->clockMs = -this->countdownMs;
+        return true;
+    }
+
+    // Call every loop iteration; runs every tick that has come due.
+    void update() {
+        if (!isRunning()) {
+            return;
+        }
+        unsigned long now = millis();
+        while (isRunning() && (long)(now - this->nextTick) >= 0) {
+            unsigned long lateness = now - this->nextTick;
+            if (lateness > this->maxLatenessMs) {
+                this->maxLatenessMs = lateness;
+            }
+            this->nextTick += LAUNCH_TICK_MS;
+            tick();
+        }
+    }
+
+    // Counting down or launching (not held)
+    bool isRunning() {
+        return this->phase == PHASE_COUNTDOWN || this->phase == PHASE_IGNITION || this->phase == PHASE_CLAMP_RELEASE;
+    }
+
+    LaunchPhase getPhase() {
+        return this->phase;
+    }
+
+    const char* getPhaseName() {
+        return LAUNCH_PHASE_NAMES[this->phase];
+    }
+
+    // T relative to ignition; negative during the countdown
+    long getClock() {
+        return this->clockMs;
+    }
+
+    long getCountdown() {
+        return this->countdownMs;
+    }
+
+    long getClampRelease() {
+        return this->clampReleaseMs;
+    }
+
+    unsigned long getTicks() {
+        return this->ticks;
+    }
+
+    // Worst delay between a tick coming due and update() running it, this sequence
+    unsigned long getMaxLateness() {
+        return this->maxLatenessMs;
+    }
+
+private:
+    LaunchActions actions;
+    LaunchPhase phase = PHASE_SAFE;
+    long countdownMs = LAUNCH_COUNTDOWN_MS;
+    long clampReleaseMs = LAUNCH_CLAMP_RELEASE_MS;
+    long clockMs = -LAUNCH_COUNTDOWN_MS;
+    bool ignited = false;
+    bool released = false;
+    unsigned long nextTick = 0;
+    unsigned long ticks = 0;
+    unsigned long maxLatenessMs = 0;
+
+    void tick() {
+        if (!this->ignited && !igniterReady()) {
+            abort(); // Lost before ignition; after it the igniter burns through
+            return;
+        }
+        this->clockMs += LAUNCH_TICK_MS;
+        this->ticks++;
+
+        if (!this->ignited && this->clockMs >= 0) {
+            this->ignited = true;
+            this->phase = PHASE_IGNITION;
+            call(this->actions.ignite);
+        }
+        if (!this->released && this->clockMs >= this->clampReleaseMs) {
+            this->released = true;
+            this->phase = PHASE_CLAMP_RELEASE;
+            call(this->actions.releaseClamps);
+        }
+        if (this->clockMs < 0 && this->clockMs % 1000 == 0) {
+            call(this->actions.countdownTick);
+        }
+        if (this->ignited && this->released && this->clockMs >= max(0L, this->clampReleaseMs) + LAUNCH_COMPLETE_MS &&
+            !(this->actions.clampsMoving && this->actions.clampsMoving())) {
+            this->phase = PHASE_COMPLETE;
+        }
+    }
+
+    bool igniterReady() {
+        return !this->actions.igniterReady || this->actions.igniterReady();
+    }
+
+    static long roundToTick(long ms) {
+        return (ms / LAUNCH_TICK_MS) * LAUNCH_TICK_MS;
+    }
+
+    static void call(void (*action)()) {
+        if (action) {
+            action();
+        }
+    }
+};
+
+#endif
@@ -1,148 +1,236 @@
-// LED CONTROLLER
+// LED PATTERNS
+//
+// The RGB LED plays looping patterns of keyframes (blink, breathe, chase,
+// blink codes) from const tables, which stay in flash. A keyframe holds its
+// colour for `ms`, or fades from it to the next keyframe's colour.
+//
+// update() only does work when something is due: at a keyframe boundary, or
+// every LED_FADE_STEP_MS during a fade. Colours go through a gamma table and
+// reach the pins only when they changed, through the output shadow.
 
 #ifndef LEDS_H
 #define LEDS_H
 #include <Arduino.h>
+#include <stdio.h>
+#include <outputs.h>
+#include <pins.h>
+#include <launchsequence.h>
 
-const int DELAY_MS = 100;
+#define LED_FADE_STEP_MS 40     // Colour steps during a fade (25 per second)
 
 struct Color {
-    int r, g, b;
-    Color(int r, int g, int b) : r(r), g(g), b(b) {}
+    uint8_t r, g, b;
+
+    bool operator==(const Color& other) const {
+        return r == other.r && g == other.g && b == other.b;
+    }
+
+    bool operator!=(const Color& other) const {
+        return !(*this == other);
+    }
 };
 
 // Basic Colors
-#if USE_RP2040
-struct Color COLOR_RED(255, 0, 0);
-struct Color COLOR_ORANGE(255, 255, 0);
-struct Color COLOR_YELLOW(255, 255, 0);
-struct Color COLOR_LIGHTGREEN(255, 255, 0);
-struct Color COLOR_GREEN(0, 255, 0);
-struct Color COLOR_LIGHTBLUE(0, 255, 255);
-struct Color COLOR_BLUE(0, 0, 255);
-struct Color COLOR_PURPLE(255, 0, 255);
-struct Color COLOR_PINK(255, 0, 255);
-struct Color COLOR_WHITE(255, 255, 255);
-struct Color COLOR_OFF(0, 0, 0);
-#else
-struct Color COLOR_RED(255, 0, 0);
-struct Color COLOR_ORANGE(255, 128, 0);
-struct Color COLOR_YELLOW(255, 255, 0);
-struct Color COLOR_LIGHTGREEN(128, 255, 0);
-struct Color COLOR_GREEN(0, 255, 0);
-struct Color COLOR_LIGHTBLUE(0, 128, 255);
-struct Color COLOR_BLUE(0, 0, 255);
-struct Color COLOR_PURPLE(128, 0, 255);
-struct Color COLOR_PINK(255, 0, 255);
-struct Color COLOR_WHITE(255, 255, 255);
-struct Color COLOR_OFF(0, 0, 0);
-#endif
+constexpr Color COLOR_RED = { 255, 0, 0 };
+constexpr Color COLOR_ORANGE = { 255, 128, 0 };
+constexpr Color COLOR_YELLOW = { 255, 255, 0 };
+constexpr Color COLOR_LIGHTGREEN = { 128, 255, 0 };
+constexpr Color COLOR_GREEN = { 0, 255, 0 };
+constexpr Color COLOR_LIGHTBLUE = { 0, 128, 255 };
+constexpr Color COLOR_BLUE = { 0, 0, 255 };
+constexpr Color COLOR_PURPLE = { 128, 0, 255 };
+constexpr Color COLOR_PINK = { 255, 0, 255 };
+constexpr Color COLOR_WHITE = { 255, 255, 255 };
+constexpr Color COLOR_OFF = { 0, 0, 0 };
 
-#define OLD_LED 1
+// Perceived brightness to PWM duty: round(255 * (i / 255) ^ 2.2)
+const uint8_t LED_GAMMA[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+};
 
-#if OLD_LED
-void showColor(Color c) {
-    analogWrite(LEDR, 255 - c.r);
-    analogWrite(LEDG, 255 - c.g);
-    analogWrite(LEDB, 255 - c.b);
-}
+enum LedKeyframeFlags : uint8_t {
+    LED_HOLD = 0,
+    LED_FADE = 1,   // Fade towards the next keyframe's colour
+};
 
-#elif !USE_RP2040
-void showColor(Color c) {
-    pinMode(LEDR, OUTPUT);
-    pinMode(LEDG, OUTPUT);
-    pinMode(LEDB, OUTPUT);
-    if (c.r == 255) {
-        digitalWrite(LEDR, LOW);
-    }
-    else if (c.r == 0) {
-        digitalWrite(LEDR, HIGH);
-    }
-    else {
-        analogWrite(LEDR, 255 - c.r);
-    }
-    if (c.g == 255) {
-        digitalWrite(LEDG, LOW);
-    }
-    else if (c.g == 0) {
-        digitalWrite(LEDG, HIGH);
-    }
-    else {
-        analogWrite(LEDG, 255 - c.g);
-    }
-    if (c.b == 255) {
-        digitalWrite(LEDB, LOW);
-    }
-    else if (c.b == 0) {
-        digitalWrite(LEDB, HIGH);
-    }
-    else {
-        analogWrite(LEDB, 255 - c.b);
-    }
-}
+struct LedKeyframe {
+    Color color;
+    uint8_t flags;
+    uint16_t ms;    // 0 = hold forever
+};
 
-#else
-void showColor(Color c) {
-    if (c.r == 255) {
-        digitalWrite(LEDR, LOW);
-    }
-    else if (c.r == 0) {
-        digitalWrite(LEDR, HIGH);
-    }
-    if (c.g == 255) {
-        digitalWrite(LEDG, LOW);
-    }
-    else if (c.g == 0) {
-        digitalWrite(LEDG, HIGH);
-    }
-    if (c.b == 255) {
-        digitalWrite(LEDB, LOW); 
-    }
-    else if (c.b == 0) {
-        digitalWrite(LEDB, HIGH);
-    }
-}
+struct LedPattern {
+    const char* name;
+    const LedKeyframe* frames;
+    uint8_t count;
+};
 
-#endif
+#define LED_PATTERN(name, frames) { name, frames, sizeof(frames) / sizeof(frames[0]) }
 
-void off() {
-    showColor(COLOR_OFF);
-}
+const LedKeyframe FRAMES_SAFE[] = {         // Breathe
+    { COLOR_OFF, LED_FADE, 1000 }, { COLOR_BLUE, LED_FADE, 1000 },
+};
+const LedKeyframe FRAMES_ARMED[] = {        // Blink
+    { COLOR_ORANGE, LED_HOLD, 500 }, { COLOR_OFF, LED_HOLD, 500 },
+};
+const LedKeyframe FRAMES_COUNTDOWN[] = {    // Short blink every second
+    { COLOR_YELLOW, LED_HOLD, 150 }, { COLOR_OFF, LED_HOLD, 850 },
+};
+const LedKeyframe FRAMES_HOLD[] = {
+    { COLOR_OFF, LED_FADE, 500 }, { COLOR_PURPLE, LED_FADE, 500 },
+};
+const LedKeyframe FRAMES_IGNITION[] = {     // Strobe
+    { COLOR_RED, LED_HOLD, 50 }, { COLOR_WHITE, LED_HOLD, 50 },
+};
+const LedKeyframe FRAMES_CLAMP_RELEASE[] = {
+    { COLOR_RED, LED_HOLD, 100 }, { COLOR_ORANGE, LED_HOLD, 100 }, { COLOR_YELLOW, LED_HOLD, 100 },
+};
+const LedKeyframe FRAMES_COMPLETE[] = {     // Chase
+    { COLOR_GREEN, LED_FADE, 300 }, { COLOR_LIGHTBLUE, LED_FADE, 300 }, { COLOR_BLUE, LED_FADE, 300 },
+};
+const LedKeyframe FRAMES_ABORT[] = {
+    { COLOR_RED, LED_HOLD, 100 }, { COLOR_OFF, LED_HOLD, 100 },
+};
+const LedKeyframe FRAMES_FAULT[] = {        // Blink code: three red blinks, pause
+    { COLOR_RED, LED_HOLD, 150 }, { COLOR_OFF, LED_HOLD, 150 },
+    { COLOR_RED, LED_HOLD, 150 }, { COLOR_OFF, LED_HOLD, 150 },
+    { COLOR_RED, LED_HOLD, 150 }, { COLOR_OFF, LED_HOLD, 1000 },
+};
 
-void flash(Color c) {
-    if (((millis() / DELAY_MS) & 1) == 1) {
-        showColor(c);
-    }
-    else {
-        showColor(COLOR_OFF);
+const LedPattern PATTERN_SAFE = LED_PATTERN("safe", FRAMES_SAFE);
+const LedPattern PATTERN_ARMED = LED_PATTERN("armed", FRAMES_ARMED);
+const LedPattern PATTERN_COUNTDOWN = LED_PATTERN("countdown", FRAMES_COUNTDOWN);
+const LedPattern PATTERN_HOLD = LED_PATTERN("hold", FRAMES_HOLD);
+const LedPattern PATTERN_IGNITION = LED_PATTERN("ignition", FRAMES_IGNITION);
+const LedPattern PATTERN_CLAMP_RELEASE = LED_PATTERN("clamp_release", FRAMES_CLAMP_RELEASE);
+const LedPattern PATTERN_COMPLETE = LED_PATTERN("complete", FRAMES_COMPLETE);
+const LedPattern PATTERN_ABORT = LED_PATTERN("abort", FRAMES_ABORT);
+const LedPattern PATTERN_FAULT = LED_PATTERN("fault", FRAMES_FAULT);
+
+// Indexed by LaunchPhase
+const LedPattern* const PHASE_PATTERNS[LAUNCH_PHASE_COUNT] = {
+    &PATTERN_SAFE, &PATTERN_ARMED, &PATTERN_COUNTDOWN, &PATTERN_HOLD,
+    &PATTERN_IGNITION, &PATTERN_CLAMP_RELEASE, &PATTERN_COMPLETE, &PATTERN_ABORT
+};
+
+// The pattern for a phase; PATTERN_SAFE for anything out of range
+inline const LedPattern& phasePattern(LaunchPhase phase) {
+    if (phase < 0 || phase >= LAUNCH_PHASE_COUNT) {
+        return PATTERN_SAFE;
     }
+    return *PHASE_PATTERNS[phase];
 }
 
-void flash(Color c, int DELAY_MS) {
-    if (((millis() / DELAY_MS) & 1) == 1) {
-        showColor(c);
+class LedPlayer {
+public:
+    uint32_t steps = 0;     // Colours computed
+    uint32_t writes = 0;    // Colours that differed from the last one shown
+
+    // Starts `pattern` from its first keyframe, unless it is already playing.
+    void play(const LedPattern& pattern) {
+        if (this->pattern == &pattern) {
+            return;
+        }
+        this->pattern = &pattern;
+        this->frame = 0;
+        this->frameStart = millis();
+        this->nextStep = this->frameStart;
+        this->holding = false;
     }
-    else {
-        showColor(COLOR_OFF);
+
+    // Call every loop iteration.
+    void update() {
+        if (!this->pattern || this->holding) {
+            return;
+        }
+        unsigned long now = millis();
+        if ((long)(now - this->nextStep) < 0) {
+            return;
+        }
+        step(now);
     }
-}
 
-void flash(Color c1, Color c2) {
-    if (((millis() / DELAY_MS) & 1) == 1) {
-        showColor(c1);
+    // Turns the LED off and stops the pattern.
+    void off() {
+        this->pattern = nullptr;
+        show(COLOR_OFF);
     }
-    else {
-        showColor(c2);
+
+    // "leds pattern=.. steps=.. writes=.."
+    int format(char* buffer, size_t size) const {
+        return snprintf(buffer, size, "leds pattern=%s steps=%lu writes=%lu\n",
+            this->pattern ? this->pattern->name : "off",
+            (unsigned long)this->steps, (unsigned long)this->writes);
     }
-}
 
-void flash(Color c1, Color c2, int DELAY_MS) {
-    if (((millis() / DELAY_MS) & 1) == 1) {
-        showColor(c1);
+private:
+    const LedPattern* pattern = nullptr;
+    uint8_t frame = 0;
+    unsigned long frameStart = 0;
+    unsigned long nextStep = 0;
+    bool holding = false;
+    bool shown = false;
+    Color last = COLOR_OFF;
+
+    void step(unsigned long now) {
+        const LedKeyframe* key = &this->pattern->frames[this->frame];
+        // Skip whole keyframes if the loop was late
+        while (key->ms != 0 && now - this->frameStart >= key->ms) {
+            this->frameStart += key->ms;
+            this->frame = (this->frame + 1) % this->pattern->count;
+            key = &this->pattern->frames[this->frame];
+        }
+        this->steps++;
+        if (key->ms == 0) {
+            this->holding = true;
+            show(key->color);
+            return;
+        }
+        unsigned long frameEnd = this->frameStart + key->ms;
+        if (!(key->flags & LED_FADE)) {
+            this->nextStep = frameEnd;
+            show(key->color);
+            return;
+        }
+        const Color& to = this->pattern->frames[(this->frame + 1) % this->pattern->count].color;
+        uint32_t t = now - this->frameStart;
+        show({ mix(key->color.r, to.r, t, key->ms), mix(key->color.g, to.g, t, key->ms),
+            mix(key->color.b, to.b, t, key->ms) });
+        this->nextStep = (long)(frameEnd - (now + LED_FADE_STEP_MS)) < 0 ? frameEnd : now + LED_FADE_STEP_MS;
     }
-    else {
-        showColor(c2);
+
+    static uint8_t mix(uint8_t from, uint8_t to, uint32_t t, uint32_t ms) {
+        return from + ((int32_t)to - from) * (int32_t)t / (int32_t)ms;
     }
-}
+
+    void show(const Color& c) {
+        if (this->shown && c == this->last) {
+            return;
+        }
+        this->shown = true;
+        this->last = c;
+        this->writes++;
+        outputs.writePwm(LEDR, LedPolarity::duty(LED_GAMMA[c.r]));
+        outputs.writePwm(LEDG, LedPolarity::duty(LED_GAMMA[c.g]));
+        outputs.writePwm(LEDB, LedPolarity::duty(LED_GAMMA[c.b]));
+    }
+};
+
+LedPlayer leds;
 
 #endif
@@ -0,0 +1,179 @@
+// LOOP INSTRUMENTATION
+//
+// Fixed-bucket histograms of loop() iteration time and of each stage within
+// an iteration. Everything is statically sized and recording a sample is a
+// handful of integer ops, cheap enough to leave on in the field.
+
+#ifndef LOOPSTATS_H
+#define LOOPSTATS_H
+#include <Arduino.h>
+#include <stdio.h>
+#include "eventlog.h"
+
+// An iteration (or stage) slower than this counts as an overrun.
+#ifndef LOOP_OVERRUN_US
+#define LOOP_OVERRUN_US 5000
+#endif
+
+#define LOOPSTATS_FORMAT_BUFFER_SIZE 3072
+
+// Log-linear buckets: four per power of two, so a bucket is never wider than
+// a quarter of its value. Samples above ~16.7 s land in the last bucket.
+const int LOOPSTATS_MAX_EXPONENT = 23;
+const int LOOPSTATS_NUM_BUCKETS = 4 * LOOPSTATS_MAX_EXPONENT;
+
+inline int loopStatsBucket(uint32_t us) {
+    if (us < 4) return us;
+    int exponent = 31 - __builtin_clz(us);
+    int index = 4 * (exponent - 1) + ((us >> (exponent - 2)) & 3);
+    return index < LOOPSTATS_NUM_BUCKETS ? index : LOOPSTATS_NUM_BUCKETS - 1;
+}
+
+inline uint32_t loopStatsBucketUpperEdge(int index) {
+    if (index < 4) return index;
+    int shift = index / 4 - 1;
+    return ((uint32_t)(4 + index % 4) << shift) + (1UL << shift) - 1;
+}
+
+class CycleHistogram {
+public:
+    uint32_t count = 0;
+    uint32_t minUs = UINT32_MAX;
+    uint32_t maxUs = 0;
+    uint64_t total = 0;
+    uint32_t overruns = 0;
+    uint32_t overrunUs = LOOP_OVERRUN_US;
+    uint32_t buckets[LOOPSTATS_NUM_BUCKETS] = { 0 };
+
+    void record(uint32_t us) {
+        this->buckets[loopStatsBucket(us)]++;
+        this->count++;
+        this->total += us;
+        if (us < this->minUs) this->minUs = us;
+        if (us > this->maxUs) this->maxUs = us;
+        if (us > this->overrunUs) this->overruns++;
+    }
+
+    // Upper edge of the bucket holding the given percentile, capped at the
+    // observed maximum. Conservative: never reports less than the true value.
+    uint32_t percentile(int pct) const {
+        if (this->count == 0) return 0;
+        uint32_t target = ((uint64_t)this->count * pct + 99) / 100;
+        uint32_t seen = 0;
+        for (int i = 0; i < LOOPSTATS_NUM_BUCKETS; i++) {
+            seen += this->buckets[i];
+            if (seen >= target) {
+                uint32_t edge = loopStatsBucketUpperEdge(i);
+                return edge < this->maxUs ? edge : this->maxUs;
+            }
+        }
+        return this->maxUs;
+    }
+
+    uint32_t mean() const {
+        return this->count ? (uint32_t)(this->total / this->count) : 0;
+    }
+
+    void reset() {
+        uint32_t overrunUs = this->overrunUs;
+        *this = CycleHistogram();
+        this->overrunUs = overrunUs;
+    }
+
+    int format(char* buffer, size_t size, const char* name) const {
+        return snprintf(buffer, size,
+            "%s count=%lu min=%lu p50=%lu p99=%lu max=%lu mean=%lu overruns=%lu\n",
+            name,
+            (unsigned long)this->count,
+            (unsigned long)(this->count ? this->minUs : 0),
+            (unsigned long)this->percentile(50),
+            (unsigned long)this->percentile(99),
+            (unsigned long)this->maxUs,
+            (unsigned long)this->mean(),
+            (unsigned long)this->overruns);
+    }
+};
+
+enum LoopStage {
+    STAGE_NETWORK,  // server.handleClient() and Wi-Fi housekeeping
+    STAGE_DELAY,    // the stabilising delay(1), or waiting for the next control tick
+    STAGE_LEDS,     // leds.update()
+    STAGE_SEQUENCE, // sequence.update(), clamps.update()
+    STAGE_PYRO,     // pyros.update()
+    STAGE_BUZZER,   // buzzer.update()
+    STAGE_EVENTS,   // Server-Sent Event state frames
+    STAGE_COMMANDS, // commands handed over from the network core
+    STAGE_SENSORS,  // continuity and pad voltage sampling
+    LOOP_STAGE_COUNT
+};
+
+const char* const LOOP_STAGE_NAMES[LOOP_STAGE_COUNT] = {
+    "network", "delay", "leds", "sequence", "pyro", "buzzer", "events", "commands", "sensors"
+};
+
+class LoopStats {
+public:
+    CycleHistogram iteration;
+    CycleHistogram stages[LOOP_STAGE_COUNT];
+
+    // Call first thing in loop(). Iteration time is measured start-to-start,
+    // so it also covers whatever the core does between loop() calls.
+    void beginIteration() {
+        unsigned long now = micros();
+        if (this->started) {
+            uint32_t us = now - this->iterationStart;
+            this->iteration.record(us);
+            if (us > this->iteration.overrunUs) {
+                eventLog.log(EVENT_LOOP_OVERRUN, 0, min(us, (uint32_t)UINT16_MAX));
+            }
+        }
+        this->started = true;
+        this->iterationStart = now;
+        this->stageStart = now;
+    }
+
+    // Call after each stage; records the time since the previous mark.
+    void mark(LoopStage stage) {
+        unsigned long now = micros();
+        this->stages[stage].record(now - this->stageStart);
+        this->stageStart = now;
+    }
+
+    void reset() {
+        this->iteration.reset();
+        for (int i = 0; i < LOOP_STAGE_COUNT; i++) {
+            this->stages[i].reset();
+        }
+        this->started = false;
+    }
+
+    // Writes one line per histogram: "<name> count=.. min=.. p50=.. p99=.. max=.. mean=.. overruns=..".
+    // All times are in microseconds. Names get "<prefix>." in front when a
+    // prefix is given (one LoopStats per core); stages never marked are left out.
+    size_t format(char* buffer, size_t size, const char* prefix = nullptr) const {
+        size_t len = 0;
+        char name[32];
+        snprintf(name, sizeof(name), "%s%sloop", prefix ? prefix : "", prefix ? "." : "");
+        len += clampLen(this->iteration.format(buffer, size, name), size);
+        for (int i = 0; i < LOOP_STAGE_COUNT && len < size; i++) {
+            if (this->stages[i].count == 0) {
+                continue;
+            }
+            snprintf(name, sizeof(name), "%s%sstage.%s", prefix ? prefix : "", prefix ? "." : "", LOOP_STAGE_NAMES[i]);
+            len += clampLen(this->stages[i].format(buffer + len, size - len, name), size - len);
+        }
+        return len;
+    }
+
+private:
+    bool started = false;
+    unsigned long iterationStart = 0;
+    unsigned long stageStart = 0;
+
+    static size_t clampLen(int written, size_t size) {
+        if (written < 0) return 0;
+        return (size_t)written < size ? (size_t)written : size - 1;
+    }
+};
+
+#endif
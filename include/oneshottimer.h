@@ -0,0 +1,158 @@
+// ONE-SHOT TIMER
+//
+// Calls a function once, a given number of microseconds from now, off a
+// hardware timer rather than from loop():
+//   RP2040: a pico-sdk hardware alarm of its own; the callback runs in
+//           interrupt context on the core that called begin(), so the timer
+//           works from core 1 as well (mbed::Timeout only ever fires on core 0)
+//   ESP32:  esp_timer, callback dispatched straight from the esp_timer
+//           interrupt where the IDF allows it (ESP_TIMER_ISR, so expire() is
+//           in IRAM; mark the callback ONESHOT_TIMER_IRAM too); otherwise
+//           from the high-priority esp_timer task, which adds a task switch
+//           of latency and jitter to every step
+//   native: no timer; isHardware() is false and the owner must poll
+// Callbacks must be short and must not allocate, print or block. State the
+// owner shares with its callback is changed under a OneShotTimer::Lock.
+
+#ifndef ONESHOTTIMER_H
+#define ONESHOTTIMER_H
+#include <Arduino.h>
+#if USE_RP2040
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#elif USE_ESP32
+#include <esp_timer.h>
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+#define ONESHOT_TIMER_ISR 1
+#endif
+#endif
+
+// Puts code a callback runs in IRAM, for the esp_timer interrupt
+#if ONESHOT_TIMER_ISR
+#define ONESHOT_TIMER_IRAM IRAM_ATTR
+#else
+#define ONESHOT_TIMER_IRAM
+#endif
+
+class OneShotTimer {
+public:
+    typedef void (*Callback)(void* arg);
+
+    // Keeps the callback from running while held, on either core: the
+    // alarm interrupt is masked on RP2040 (it fires on the owner's core),
+    // the ESP32 takes a spinlock shared with the esp_timer interrupt or
+    // task. Nests.
+    class Lock {
+    public:
+        Lock(OneShotTimer& timer) {
+        #if USE_RP2040
+            (void)timer;
+            this->state = save_and_disable_interrupts();
+        #elif USE_ESP32
+            this->mux = &timer.mux;
+            portENTER_CRITICAL_SAFE(this->mux); // Task or interrupt context
+        #else
+            (void)timer;
+        #endif
+        }
+
+        ~Lock() {
+        #if USE_RP2040
+            restore_interrupts(this->state);
+        #elif USE_ESP32
+            portEXIT_CRITICAL_SAFE(this->mux);
+        #endif
+        }
+
+    private:
+    #if USE_RP2040
+        uint32_t state;
+    #elif USE_ESP32
+        portMUX_TYPE* mux;
+    #endif
+    };
+
+    void begin(Callback callback, void* arg) {
+        this->callback = callback;
+        this->arg = arg;
+    #if USE_RP2040
+        if (this->alarm < 0) {
+            this->alarm = hardware_alarm_claim_unused(true);
+            owners()[this->alarm] = this;
+            hardware_alarm_set_callback(this->alarm, &OneShotTimer::onAlarm); // IRQ on this core
+        }
+    #elif USE_ESP32
+        if (!this->handle) {
+            esp_timer_create_args_t args = {};
+            args.callback = &OneShotTimer::expire;
+            args.arg = this;
+        #if ONESHOT_TIMER_ISR
+            args.dispatch_method = ESP_TIMER_ISR;
+        #else
+            args.dispatch_method = ESP_TIMER_TASK;
+        #endif
+            args.name = "oneshot";
+            esp_timer_create(&args, &this->handle);
+        }
+    #endif
+    }
+
+    // Restarts the timer if it is already running.
+    void start(uint32_t us) {
+    #if USE_RP2040
+        if (hardware_alarm_set_target(this->alarm, delayed_by_us(get_absolute_time(), us))) {
+            expire(this); // Already due
+        }
+    #elif USE_ESP32
+        esp_timer_stop(this->handle);
+        esp_timer_start_once(this->handle, us);
+    #else
+        (void)us;
+    #endif
+    }
+
+    // A callback already running is not waited for; see Lock.
+    void cancel() {
+    #if USE_RP2040
+        hardware_alarm_cancel(this->alarm);
+    #elif USE_ESP32
+        esp_timer_stop(this->handle);
+    #endif
+    }
+
+    static constexpr bool isHardware() {
+    #if USE_RP2040 || USE_ESP32
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+private:
+    Callback callback = nullptr;
+    void* arg = nullptr;
+#if USE_RP2040
+    int alarm = -1;
+
+    static OneShotTimer** owners() {
+        static OneShotTimer* timers[NUM_TIMERS] = {};
+        return timers;
+    }
+
+    static void onAlarm(uint alarm) {
+        expire(owners()[alarm]);
+    }
+#elif USE_ESP32
+    esp_timer_handle_t handle = nullptr;
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+    static void ONESHOT_TIMER_IRAM expire(void* self) {
+        OneShotTimer* timer = (OneShotTimer*)self;
+        if (timer->callback) {
+            timer->callback(timer->arg);
+        }
+    }
+};
+
+#endif
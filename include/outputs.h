@@ -0,0 +1,124 @@
+// OUTPUT SHADOW
+//
+// Remembers the last value written to each output pin (digital level, PWM
+// duty or tone frequency) and only touches the hardware when it changes.
+// beepTone() and the pyro idle path write the same values every
+// loop iteration; on the Nano RP2040 Connect the RGB LED hangs off the NINA
+// module, so each of those writes is an SPI transaction.
+//
+// Anything that drives a pin behind the shadow's back must call invalidate().
+//
+// Both cores write through the one shadow (their pins are disjoint), so the
+// write counts are kept per core: each core only ever changes its own, and
+// resetCounters() has to run on each core that writes.
+
+#ifndef OUTPUTS_H
+#define OUTPUTS_H
+#include <Arduino.h>
+#include <stdio.h>
+#if USE_RP2040
+#include "pico/platform.h"
+#endif
+
+#define OUTPUTS_MAX_PIN 64  // Higher pin numbers are written through, uncached
+#define OUTPUTS_CORES 2
+
+class ShadowOutputs {
+public:
+    void writeDigital(int pin, int level) {
+        if (changed(pin, KIND_DIGITAL, level ? 1 : 0)) {
+            ::digitalWrite(pin, level);
+        }
+    }
+
+    void writePwm(int pin, int duty) {
+        if (changed(pin, KIND_PWM, duty)) {
+            ::analogWrite(pin, duty);
+        }
+    }
+
+    void writeTone(int pin, unsigned int freq) {
+        if (changed(pin, KIND_TONE, freq)) {
+            ::tone(pin, freq);
+        }
+    }
+
+    // A timed tone ends by itself, so the pin's state is unknown afterwards.
+    void writeTone(int pin, unsigned int freq, unsigned long duration) {
+        invalidate(pin);
+        counts().performed++;
+        ::tone(pin, freq, duration);
+    }
+
+    void stopTone(int pin) {
+        if (changed(pin, KIND_TONE, 0)) {
+            ::noTone(pin);
+        }
+    }
+
+    // Forgets the pin's state, so the next write always goes through.
+    void invalidate(int pin) {
+        if (pin >= 0 && pin < OUTPUTS_MAX_PIN) {
+            this->kind[pin] = KIND_UNKNOWN;
+        }
+    }
+
+    // Clears the calling core's counts.
+    void resetCounters() {
+        counts() = Counters();
+    }
+
+    // Totals over both cores
+    int format(char* buffer, size_t size) const {
+        uint32_t performed = 0;
+        uint32_t avoided = 0;
+        for (int i = 0; i < OUTPUTS_CORES; i++) {
+            performed += this->counters[i].performed;
+            avoided += this->counters[i].avoided;
+        }
+        return snprintf(buffer, size, "outputs performed=%lu avoided=%lu\n",
+            (unsigned long)performed, (unsigned long)avoided);
+    }
+
+private:
+    enum Kind : uint8_t { KIND_UNKNOWN, KIND_DIGITAL, KIND_PWM, KIND_TONE };
+
+    struct Counters {
+        uint32_t performed = 0;     // Writes that reached the hardware
+        uint32_t avoided = 0;       // Writes skipped because nothing changed
+    };
+
+    Kind kind[OUTPUTS_MAX_PIN] = {};
+    uint16_t value[OUTPUTS_MAX_PIN] = {};
+    Counters counters[OUTPUTS_CORES];
+
+    Counters& counts() {
+    #if USE_RP2040
+        return this->counters[get_core_num()];
+    #elif USE_ESP32
+        return this->counters[xPortGetCoreID()];
+    #else
+        return this->counters[0];
+    #endif
+    }
+
+    // Records the write and returns true if the hardware needs it.
+    bool changed(int pin, Kind kind, unsigned int value) {
+        if (pin < 0 || pin >= OUTPUTS_MAX_PIN) {
+            counts().performed++;
+            return true;
+        }
+        if (this->kind[pin] == kind && this->value[pin] == value) {
+            counts().avoided++;
+            return false;
+        }
+        this->kind[pin] = kind;
+        this->value[pin] = value;
+        counts().performed++;
+        return true;
+    }
+};
+
+ShadowOutputs outputs;
+
+#endif
@@ -0,0 +1,87 @@
+// PAD COMMAND FRAMES
+//
+// Binary command and acknowledgement frames for the WebSocket control channel.
+//
+//   Command: [command][seq][arg1][arg2]                  (args are int8, nudge only)
+//   Ack:     [command][seq][status][clamp1][clamp2][flags]
+//
+// The ack echoes the command and sequence number so the client can match it
+// to the request and time the round trip.
+
+#ifndef PADCOMMANDS_H
+#define PADCOMMANDS_H
+#include <Arduino.h>
+
+enum PadCommand : uint8_t {
+    CMD_PING = 0,           // No action; for measuring round trips
+    CMD_LAUNCH = 1,
+    CMD_ABORT = 2,
+    CMD_CLAMPS_OPEN = 3,
+    CMD_CLAMPS_CLOSE = 4,
+    CMD_CLAMPS_NUDGE = 5,
+    CMD_HOLD = 6,
+    CMD_RECYCLE = 7,
+    CMD_ARM = 8,
+    CMD_DISARM = 9,
+    PAD_COMMAND_COUNT
+};
+
+const char* const PAD_COMMAND_NAMES[PAD_COMMAND_COUNT] = {
+    "ping", "launch", "abort", "clamps_open", "clamps_close", "clamps_nudge", "hold", "recycle", "arm", "disarm"
+};
+
+enum PadCommandStatus : uint8_t {
+    CMD_STATUS_OK = 0,
+    CMD_STATUS_BAD_FRAME = 1,
+    CMD_STATUS_UNKNOWN_COMMAND = 2,
+    CMD_STATUS_REJECTED = 3,        // Not allowed in the current launch phase
+    CMD_STATUS_BUSY = 4,            // Not run: the control loop did not take it in time, or an abort dropped it
+    CMD_STATUS_NO_CONTINUITY = 5    // Arming refused: no valid igniter continuity reading
+};
+
+// Ack flag bits
+const uint8_t PAD_FLAG_ARMED = 0x01;
+const uint8_t PAD_FLAG_FIRING = 0x02;
+
+const size_t PAD_COMMAND_FRAME_SIZE = 4;
+const size_t PAD_ACK_FRAME_SIZE = 6;
+
+struct PadCommandFrame {
+    uint8_t command;
+    uint8_t seq;
+    int8_t arg1;
+    int8_t arg2;
+
+    // Accepts frames of at least PAD_COMMAND_FRAME_SIZE bytes; extra bytes are ignored.
+    bool decode(const uint8_t* data, size_t len) {
+        if (len < PAD_COMMAND_FRAME_SIZE) {
+            return false;
+        }
+        this->command = data[0];
+        this->seq = data[1];
+        this->arg1 = (int8_t)data[2];
+        this->arg2 = (int8_t)data[3];
+        return true;
+    }
+};
+
+struct PadAckFrame {
+    uint8_t command;
+    uint8_t seq;
+    uint8_t status;
+    uint8_t clamp1;
+    uint8_t clamp2;
+    uint8_t flags;
+
+    size_t encode(uint8_t* out) const {
+        out[0] = this->command;
+        out[1] = this->seq;
+        out[2] = this->status;
+        out[3] = this->clamp1;
+        out[4] = this->clamp2;
+        out[5] = this->flags;
+        return PAD_ACK_FRAME_SIZE;
+    }
+};
+
+#endif
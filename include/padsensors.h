@@ -0,0 +1,198 @@
+// PAD SENSORS
+//
+// Igniter continuity and pad supply voltage, sampled at a fixed rate from
+// the control loop:
+//   RP2040: the ADC free-runs round-robin over both inputs into its 4-deep
+//           FIFO; update() only drains it
+//   ESP32, native: update() runs one analogRead() per sample slot that has
+//           come due, alternating between the inputs
+// update() handles at most SENSOR_MAX_SAMPLES_PER_UPDATE samples per call,
+// so its share of a loop iteration is bounded whatever happened before.
+//
+// Per input, SENSOR_OVERSAMPLE raw 12-bit samples are summed and decimated
+// to 14 bits, then smoothed by a one-pole IIR filter, all in integers.
+//
+// The continuity sense is a small test current from the pad supply through
+// the igniter: the input reads near 0 V with an igniter in circuit and is
+// pulled up when it is open. The reading only counts once the filters have
+// settled and the pad supply is up, since with no supply an open igniter
+// also reads 0 V.
+
+#ifndef PADSENSORS_H
+#define PADSENSORS_H
+#include <Arduino.h>
+#include <stdio.h>
+#include <pins.h>
+#if USE_RP2040
+#include "hardware/adc.h"
+#endif
+
+#define SENSOR_SAMPLE_US 500            // One input sampled per slot (1 kHz per input)
+#define SENSOR_MAX_SAMPLES_PER_UPDATE 4 // Bound on the work done by one update()
+#define SENSOR_OVERSAMPLE 16            // Raw samples per decimated value (+2 bits)
+#define SENSOR_IIR_SHIFT 3              // Filter weight 1/8 per decimated value
+#define SENSOR_SETTLE_VALUES 32         // Decimated values before a reading counts
+#define SENSOR_VREF_MV 3300
+#define PAD_VOLTAGE_SCALE 11            // Divider on the pad supply input (100k / 10k)
+#define PAD_VOLTAGE_MIN_MV 6000         // Below this the continuity reading means nothing
+#define CONTINUITY_MAX_MV 300           // Sense input at or below this: igniter present
+
+// Oversampling and IIR filter for one input; takes raw 12-bit samples.
+class SensorFilter {
+public:
+    // True when the sample completed a decimated value.
+    bool add(uint16_t raw) {
+        this->sum += raw;
+        if (++this->count < SENSOR_OVERSAMPLE) {
+            return false;
+        }
+        uint32_t value = this->sum >> 2; // 16 x 12 bits -> 14 bits
+        this->sum = 0;
+        this->count = 0;
+        if (this->values == 0) {
+            this->state = value << SENSOR_IIR_SHIFT; // Start from the first value, not from 0
+        }
+        else {
+            this->state += value - (this->state >> SENSOR_IIR_SHIFT);
+        }
+        if (this->values < SENSOR_SETTLE_VALUES) {
+            this->values++;
+        }
+        return true;
+    }
+
+    // Filtered value, 14 bits
+    uint16_t value() const {
+        return this->state >> SENSOR_IIR_SHIFT;
+    }
+
+    uint32_t millivolts() const {
+        return ((uint32_t)value() * SENSOR_VREF_MV) >> 14;
+    }
+
+    bool settled() const {
+        return this->values >= SENSOR_SETTLE_VALUES;
+    }
+
+    void reset() {
+        *this = SensorFilter();
+    }
+
+private:
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    uint32_t state = 0;
+    uint32_t values = 0;
+};
+
+class PadSensors {
+public:
+    enum Channel { CONTINUITY, PAD_VOLTAGE, CHANNEL_COUNT };
+
+    uint32_t samples = 0;       // Raw samples taken
+    uint32_t overflows = 0;     // RP2040: FIFO overruns (samples lost, pipeline restarted)
+    uint32_t skipped = 0;       // ESP32/native: sample slots missed because the loop was late
+
+    void begin() {
+        this->pins[CONTINUITY] = PYRO_CONTINUITY_PIN;
+        this->pins[PAD_VOLTAGE] = PAD_VOLTAGE_PIN;
+    #if USE_RP2040
+        adc_init();
+        uint mask = 0;
+        for (int i = 0; i < CHANNEL_COUNT; i++) {
+            int gpio = (int)digitalPinToPinName(this->pins[i]);
+            adc_gpio_init(gpio);
+            this->inputs[i] = gpio - 26;
+            mask |= 1u << this->inputs[i];
+        }
+        // Round robin visits the inputs in ascending order
+        this->first = this->inputs[CONTINUITY] < this->inputs[PAD_VOLTAGE] ? CONTINUITY : PAD_VOLTAGE;
+        adc_set_round_robin(mask);
+        adc_fifo_setup(true, false, 1, false, false);
+        adc_set_clkdiv(48000000.0f * SENSOR_SAMPLE_US / 1000000 - 1); // 48 MHz ADC clock
+        restart();
+    #else
+        analogReadResolution(12);
+        this->nextSample = micros();
+    #endif
+    }
+
+    // Call every control loop iteration.
+    void update() {
+    #if USE_RP2040
+        if (adc_hw->fcs & ADC_FCS_OVER_BITS) {
+            this->overflows++;
+            restart(); // Lost samples: the FIFO no longer says which input is next
+            return;
+        }
+        for (int n = 0; n < SENSOR_MAX_SAMPLES_PER_UPDATE && adc_fifo_get_level() > 0; n++) {
+            add(this->next, adc_fifo_get());
+        }
+    #else
+        unsigned long now = micros();
+        for (int n = 0; n < SENSOR_MAX_SAMPLES_PER_UPDATE && (long)(now - this->nextSample) >= 0; n++) {
+            add(this->next, analogRead(this->pins[this->next]));
+            this->nextSample += SENSOR_SAMPLE_US;
+        }
+        if ((long)(now - this->nextSample) >= 0) {
+            // Too far behind to catch up within the bound; drop the missed slots
+            this->skipped += (now - this->nextSample) / SENSOR_SAMPLE_US + 1;
+            this->nextSample = now + SENSOR_SAMPLE_US;
+        }
+    #endif
+    }
+
+    uint32_t continuityMv() const {
+        return this->filters[CONTINUITY].millivolts();
+    }
+
+    uint32_t padMv() const {
+        return this->filters[PAD_VOLTAGE].millivolts() * PAD_VOLTAGE_SCALE;
+    }
+
+    // The readings are settled and the pad supply is up
+    bool valid() const {
+        return this->filters[CONTINUITY].settled() && this->filters[PAD_VOLTAGE].settled() &&
+            padMv() >= PAD_VOLTAGE_MIN_MV;
+    }
+
+    bool hasContinuity() const {
+        return valid() && continuityMv() <= CONTINUITY_MAX_MV;
+    }
+
+    // "sensors continuity=.. continuity_mv=.. pad_mv=.. valid=.. samples=.. overflows=.. skipped=.."
+    int format(char* buffer, size_t size) const {
+        return snprintf(buffer, size,
+            "sensors continuity=%d continuity_mv=%lu pad_mv=%lu valid=%d samples=%lu overflows=%lu skipped=%lu\n",
+            hasContinuity(), (unsigned long)continuityMv(), (unsigned long)padMv(), valid(),
+            (unsigned long)this->samples, (unsigned long)this->overflows, (unsigned long)this->skipped);
+    }
+
+private:
+    int pins[CHANNEL_COUNT];
+    SensorFilter filters[CHANNEL_COUNT];
+    int next = CONTINUITY;  // Input the next sample belongs to
+#if USE_RP2040
+    int inputs[CHANNEL_COUNT];
+    int first = CONTINUITY;
+
+    void restart() {
+        adc_run(false);
+        adc_fifo_drain();
+        adc_hw->fcs |= ADC_FCS_OVER_BITS | ADC_FCS_UNDER_BITS; // Write 1 to clear
+        adc_select_input(this->inputs[this->first]);
+        this->next = this->first;
+        adc_run(true);
+    }
+#else
+    unsigned long nextSample = 0;
+#endif
+
+    void add(int channel, uint16_t raw) {
+        this->filters[channel].add(raw & 0x0FFF);
+        this->samples++;
+        this->next = (channel + 1) % CHANNEL_COUNT;
+    }
+};
+
+#endif
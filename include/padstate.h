@@ -0,0 +1,97 @@
+// PAD STATE EVENTS
+//
+// Compact snapshot of the pad, pushed to browsers as Server-Sent Events.
+// A frame goes out only when the snapshot changes, at most once per interval;
+// a comment line is sent now and then so dead connections get noticed.
+
+#ifndef PADSTATE_H
+#define PADSTATE_H
+#include <Arduino.h>
+#include <stdio.h>
+#include "launchsequence.h"
+
+#ifndef PAD_EVENTS_INTERVAL_MS
+#define PAD_EVENTS_INTERVAL_MS 100      // Minimum time between state frames
+#endif
+#define PAD_EVENTS_HEARTBEAT_MS 15000   // Keep-alive comment when nothing changes
+#define PAD_EVENTS_FRAME_SIZE 256       // Buffer for one SSE frame
+
+struct PadState {
+    bool armed = false;
+    bool firing = false;
+    int clamp1 = 0;
+    int clamp2 = 0;
+    uint32_t loopMaxMs = 0;     // Slowest loop iteration since /metrics was reset
+    uint32_t overruns = 0;      // Loop iterations over LOOP_OVERRUN_US
+    LaunchPhase phase = PHASE_SAFE;
+    long clockMs = 0;           // Sequence clock, T relative to ignition
+    bool continuity = false;    // Igniter in circuit (valid reading)
+    uint32_t padMv = 0;         // Pad supply, filtered
+
+    bool operator==(const PadState& other) const {
+        return armed == other.armed && firing == other.firing &&
+            clamp1 == other.clamp1 && clamp2 == other.clamp2 &&
+            loopMaxMs == other.loopMaxMs && overruns == other.overruns &&
+            phase == other.phase && clockMs == other.clockMs &&
+            continuity == other.continuity && padMv / 100 == other.padMv / 100; // 0.1 V steps
+    }
+
+    bool operator!=(const PadState& other) const {
+        return !(*this == other);
+    }
+
+    int toJson(char* buffer, size_t size) const {
+        return snprintf(buffer, size,
+            "{\"armed\":%d,\"firing\":%d,\"clamp1\":%d,\"clamp2\":%d,\"loopMaxMs\":%lu,\"overruns\":%lu,"
+            "\"phase\":\"%s\",\"t\":%ld,\"continuity\":%d,\"padMv\":%lu}",
+            armed, firing, clamp1, clamp2, (unsigned long)loopMaxMs, (unsigned long)overruns, LAUNCH_PHASE_NAMES[phase], clockMs,
+            continuity, (unsigned long)padMv);
+    }
+};
+
+class PadStateEvents {
+public:
+    PadStateEvents(unsigned long intervalMs = PAD_EVENTS_INTERVAL_MS) {
+        this->intervalMs = intervalMs;
+    }
+
+    void setInterval(unsigned long intervalMs) {
+        this->intervalMs = intervalMs;
+    }
+
+    // Forces the next poll() to send the current state, e.g. for a new subscriber.
+    void invalidate() {
+        this->forceSend = true;
+    }
+
+    // Fills `frame` and returns true when something should be sent to subscribers.
+    bool poll(const PadState& state, char* frame, size_t size) {
+        unsigned long now = millis();
+        if (now - this->lastSent < this->intervalMs) {
+            return false;
+        }
+        if (state == this->last && !this->forceSend) {
+            if (now - this->lastSent < PAD_EVENTS_HEARTBEAT_MS) {
+                return false;
+            }
+            snprintf(frame, size, ": heartbeat\n\n");
+        }
+        else {
+            char json[PAD_EVENTS_FRAME_SIZE - 8];
+            state.toJson(json, sizeof(json));
+            snprintf(frame, size, "data: %s\n\n", json);
+            this->last = state;
+            this->forceSend = false;
+        }
+        this->lastSent = now;
+        return true;
+    }
+
+private:
+    unsigned long intervalMs;
+    unsigned long lastSent = 0;
+    bool forceSend = true;
+    PadState last;
+};
+
+#endif
@@ -1,5 +1,70 @@
-const int PYRO_IGNITION_PIN = 4;
-const int PYRO_TEST_PIN = LED_BUILTIN;
-const int CLAMP_1_SERVO_PIN = 6;
-const int CLAMP_2_SERVO_PIN = 5;
-const int BUZZER_PIN = 7;
\ No newline at end of file
+// BOARD PIN MAP
+//
+// Every pin the firmware drives or reads, and the polarity of each kind of
+// output, as compile-time constants. Both boards are Nano-format and are
+// addressed by Arduino pin number, so they share one map; a board that
+// differs gets its own block here.
+//
+// Polarities are types rather than flags: code templated on them, like
+// PyroBank, folds the on/off choice away at compile time. Two outputs on
+// the same pin fail the build.
+
+#ifndef PINS_H
+#define PINS_H
+#include <Arduino.h>
+
+// Output polarity policies
+struct ActiveHigh {
+    enum : int { ON = HIGH, OFF = LOW };
+
+    // Mask write that turns `on` on and `off` off
+    static constexpr uint32_t setMask(uint32_t on, uint32_t) { return on; }
+    static constexpr uint32_t clearMask(uint32_t, uint32_t off) { return off; }
+
+    // PWM duty for a brightness
+    static constexpr int duty(uint8_t level) { return level; }
+};
+
+struct ActiveLow {
+    enum : int { ON = LOW, OFF = HIGH };
+
+    static constexpr uint32_t setMask(uint32_t, uint32_t off) { return off; }
+    static constexpr uint32_t clearMask(uint32_t on, uint32_t) { return on; }
+
+    static constexpr int duty(uint8_t level) { return 255 - level; }
+};
+
+// Arduino Nano ESP32, Nano RP2040 Connect, native
+constexpr int PYRO_IGNITION_PIN = 4;
+constexpr int PYRO_LANDING_MOTOR_IGNITION = 2;  // Reserved pyro channels
+constexpr int PYRO_LANDING_LEGS_DEPLOY = 3;
+constexpr int STATUS_LED_PIN = LED_BUILTIN;
+constexpr int CLAMP_1_SERVO_PIN = 6;
+constexpr int CLAMP_2_SERVO_PIN = 5;
+constexpr int BUZZER_PIN = 7;
+constexpr int PYRO_CONTINUITY_PIN = A0;         // Igniter continuity sense (analog)
+constexpr int PAD_VOLTAGE_PIN = A1;             // Pad supply through a 100k/10k divider
+
+typedef ActiveHigh PyroPolarity;    // Igniter MOSFET gates
+typedef ActiveLow LedPolarity;      // Common-anode RGB LED
+
+// The RGB LED pins come from the core (on the RP2040 board they are on the
+// NINA module), so they are not in the map below.
+constexpr int BOARD_PINS[] = {
+    PYRO_IGNITION_PIN, PYRO_LANDING_MOTOR_IGNITION, PYRO_LANDING_LEGS_DEPLOY, STATUS_LED_PIN,
+    CLAMP_1_SERVO_PIN, CLAMP_2_SERVO_PIN, BUZZER_PIN, PYRO_CONTINUITY_PIN, PAD_VOLTAGE_PIN
+};
+
+constexpr bool pinUnused(const int* pins, int count, int pin, int from) {
+    return from >= count ? true : pins[from] != pin && pinUnused(pins, count, pin, from + 1);
+}
+
+constexpr bool pinsDistinct(const int* pins, int count, int from = 0) {
+    return from >= count ? true :
+        pinUnused(pins, count, pins[from], from + 1) && pinsDistinct(pins, count, from + 1);
+}
+
+static_assert(pinsDistinct(BOARD_PINS, sizeof(BOARD_PINS) / sizeof(BOARD_PINS[0])),
+    "Two functions share a pin in the board pin map");
+
+#endif
@@ -0,0 +1,348 @@
+// PYRO BANK
+//
+// Several pyro channels fired from one schedule. Each channel turns on
+// `delay` after fire() and off `duration` later. Steps that fall on the same
+// instant are merged into a single GPIO mask write, so clustered channels
+// switch together; staged steps are timed by a hardware one-shot timer that
+// is re-armed for each step. Pins outside the mask-writable range still
+// work, with a digitalWrite per channel.
+//
+// When each channel actually switched is recorded, so the skew between
+// channels (versus the schedule) can be read back after a firing.
+//
+// The bank runs on the control core, which leaves Serial to the other one. A
+// fire() refused because the bank is not armed is logged
+// (EVENT_PYRO_REFUSED) and counted for that core to report; see getRefused()
+// and unmaskedPin().
+
+#ifndef PYROBANK_H
+#define PYROBANK_H
+#include <Arduino.h>
+#include <stdio.h>
+#include "gpiomask.h"
+#include "oneshottimer.h"
+#include "eventlog.h"
+#include "outputs.h"
+#include "pins.h"
+
+struct PyroStep {
+    int pin;
+    uint32_t delayMs;       // From fire() to on
+    uint32_t durationMs;    // On time
+};
+
+// Polarity is ActiveHigh or ActiveLow (see pins.h); it is resolved at
+// compile time, so the mask writes carry no polarity branches.
+template <int N, typename Polarity = PyroPolarity>
+class PyroBank {
+    static_assert(N > 0 && N < 32, "PyroBank tracks channels in a 32-bit mask");
+
+public:
+    PyroBank(const PyroStep (&steps)[N]) {
+        for (int i = 0; i < N; i++) {
+            this->steps[i] = steps[i];
+            this->onAt[i] = UNSET;
+            this->offAt[i] = UNSET;
+        }
+    }
+
+    void begin() {
+        this->timer.begin(&PyroBank::onTimer, this);
+        for (int i = 0; i < N; i++) {
+            this->masks[i] = gpioMaskForPin(this->steps[i].pin);
+            this->allMask |= this->masks[i];
+            pinMode(this->steps[i].pin, OUTPUT);
+        }
+        buildEvents();
+        writeOff(this->allMask);
+    }
+
+    // Refuses while the arm check (e.g. igniter continuity) says no.
+    bool arm() {
+        if (this->armCheck && !this->armCheck()) {
+            return false;
+        }
+        writeOff(this->allMask);
+        this->isArmed = true;
+        return true;
+    }
+
+    void setArmCheck(bool (*check)()) {
+        this->armCheck = check;
+    }
+
+    void disarm() {
+        this->stop();
+        this->isArmed = false;
+    }
+
+    // False if the bank is not armed, or is already firing.
+    bool fire() {
+        if (!this->isArmed) {
+            this->refused = this->refused + 1;
+            eventLog.log(EVENT_PYRO_REFUSED);
+            return false;
+        }
+        OneShotTimer::Lock lock(this->timer);
+        if (this->isFiring) {
+            return false;
+        }
+        for (int i = 0; i < N; i++) {
+            this->onAt[i] = UNSET;
+            this->offAt[i] = UNSET;
+        }
+        this->nextEvent = 0;
+        this->complete = false;
+        this->startMicros = micros();
+        this->isFiring = true;
+        runDueEvents();
+        return true;
+    }
+
+    // Everything off in one write; channels still on get their burn cut short.
+    // Holds the timer lock, so no step the callback is running lands after it.
+    void stop() {
+        OneShotTimer::Lock lock(this->timer);
+        this->timer.cancel();
+        if (this->isFiring) {
+            writeOff(this->allMask);
+            uint32_t now = micros() - this->startMicros;
+            for (int i = 0; i < N; i++) {
+                if (this->onAt[i] != UNSET && this->offAt[i] == UNSET) {
+                    this->offAt[i] = now;
+                    eventLog.log(EVENT_PYRO_OFF, i);
+                }
+            }
+            finish();
+        }
+        else {
+            writeOff(this->allMask);
+        }
+    }
+
+    bool getArmed() {
+        return this->isArmed;
+    }
+
+    bool getFiring() {
+        return this->isFiring;
+    }
+
+    // fire() calls refused since boot because the bank was not armed
+    uint32_t getRefused() const {
+        return this->refused;
+    }
+
+    // First pin that cannot be mask-written (so gets a digitalWrite), or -1.
+    // Works from the steps alone, so it can be asked before begin().
+    int unmaskedPin() const {
+        for (int i = 0; i < N; i++) {
+            if (!gpioMaskForPin(this->steps[i].pin)) {
+                return this->steps[i].pin;
+            }
+        }
+        return -1;
+    }
+
+    // Returns true once after each firing ends
+    bool takeComplete() {
+        bool complete = this->complete;
+        this->complete = false;
+        return complete;
+    }
+
+    // Only needed without a hardware timer (native); otherwise does nothing.
+    void update() {
+        if (!OneShotTimer::isHardware() && this->isFiring) {
+            OneShotTimer::Lock lock(this->timer);
+            runDueEvents();
+        }
+    }
+
+    // Spread between channels' on-time errors (actual - scheduled) for the
+    // last firing. 0 for channels switched by the same mask write.
+    uint32_t getSkew() {
+        return this->skewMicros;
+    }
+
+    uint32_t getLastBurn(int channel) {
+        if (channel < 0 || channel >= N || this->onAt[channel] == UNSET || this->offAt[channel] == UNSET) {
+            return 0;
+        }
+        return this->offAt[channel] - this->onAt[channel];
+    }
+
+    // "pyro.<name> skew_us=.. write_us=.. refused=.." then one line per channel:
+    // "pyro.<name>.<i> pin=.. delay_us=.. on_us=.. target_us=.. burn_us=.."
+    size_t format(char* buffer, size_t size, const char* name) {
+        size_t len = 0;
+        len += clampLen(snprintf(buffer, size, "pyro.%s skew_us=%lu write_us=%lu refused=%lu\n",
+            name, (unsigned long)this->skewMicros, (unsigned long)this->maxWriteMicros,
+            (unsigned long)this->refused), size);
+        for (int i = 0; i < N && len < size; i++) {
+            len += clampLen(snprintf(buffer + len, size - len,
+                "pyro.%s.%d pin=%d delay_us=%lu on_us=%ld target_us=%lu burn_us=%lu\n",
+                name, i, this->steps[i].pin,
+                (unsigned long)this->steps[i].delayMs * 1000,
+                this->onAt[i] == UNSET ? -1L : (long)this->onAt[i],
+                (unsigned long)this->steps[i].durationMs * 1000,
+                (unsigned long)getLastBurn(i)), size - len);
+        }
+        return len;
+    }
+
+private:
+    static const uint32_t UNSET = 0xFFFFFFFF;
+
+    // One mask write at `atMicros` after fire()
+    struct Event {
+        uint32_t atMicros;
+        uint32_t setMask;
+        uint32_t clearMask;
+        uint32_t onChannels;    // Bit per channel switched on / off by this event
+        uint32_t offChannels;
+    };
+
+    PyroStep steps[N];
+    uint32_t masks[N] = { 0 };
+    uint32_t allMask = 0;
+    bool isArmed = false;
+    volatile bool isFiring = false;
+    volatile bool complete = false;
+    volatile uint32_t refused = 0;  // Written by the control core only
+
+    Event events[2 * N];
+    int eventCount = 0;
+    volatile int nextEvent = 0;
+    OneShotTimer timer;
+    bool (*armCheck)() = nullptr;
+
+    uint32_t startMicros = 0;
+    volatile uint32_t onAt[N];      // Actual on/off times, micros after fire()
+    volatile uint32_t offAt[N];
+    uint32_t skewMicros = 0;
+    uint32_t maxWriteMicros = 0;
+
+    // Merges the schedule into time-ordered events, one per distinct instant.
+    void buildEvents() {
+        this->eventCount = 0;
+        for (int i = 0; i < N; i++) {
+            uint32_t on = this->steps[i].delayMs * 1000;
+            addEvent(on, i, true);
+            addEvent(on + this->steps[i].durationMs * 1000, i, false);
+        }
+    }
+
+    void addEvent(uint32_t at, int channel, bool on) {
+        int index = 0;
+        while (index < this->eventCount && this->events[index].atMicros < at) {
+            index++;
+        }
+        if (index == this->eventCount || this->events[index].atMicros != at) {
+            for (int j = this->eventCount; j > index; j--) {
+                this->events[j] = this->events[j - 1];
+            }
+            this->events[index] = Event{ at, 0, 0, 0, 0 };
+            this->eventCount++;
+        }
+        Event& event = this->events[index];
+        if (on) {
+            event.onChannels |= 1UL << channel;
+        }
+        else {
+            event.offChannels |= 1UL << channel;
+        }
+        // A channel switched on and off at once (zero duration) stays off
+        uint32_t onMask = 0;
+        uint32_t offMask = 0;
+        for (int i = 0; i < N; i++) {
+            if (event.offChannels & (1UL << i)) offMask |= this->masks[i];
+            else if (event.onChannels & (1UL << i)) onMask |= this->masks[i];
+        }
+        event.setMask = Polarity::setMask(onMask, offMask);
+        event.clearMask = Polarity::clearMask(onMask, offMask);
+    }
+
+    // Runs every event that has come due, then re-arms the timer for the next.
+    // Called from fire(), the timer callback (interrupt context on RP2040; on
+    // ESP32 the esp_timer interrupt or task, on the other core) or update(),
+    // with the timer lock held. Stops writing as soon as stop() has ended the
+    // firing.
+    void ONESHOT_TIMER_IRAM runDueEvents() {
+        uint32_t elapsed = micros() - this->startMicros;
+        while (this->isFiring && this->nextEvent < this->eventCount &&
+            this->events[this->nextEvent].atMicros <= elapsed) {
+            const Event& event = this->events[this->nextEvent++];
+            uint32_t before = micros();
+            gpioWriteMask(event.setMask, event.clearMask);
+            writeUnmasked(event.onChannels & ~event.offChannels, true);
+            writeUnmasked(event.offChannels, false);
+            uint32_t after = micros();
+            if (after - before > this->maxWriteMicros) {
+                this->maxWriteMicros = after - before;
+            }
+            uint32_t at = before - this->startMicros;
+            for (int i = 0; i < N; i++) {
+                if (event.onChannels & (1UL << i)) {
+                    this->onAt[i] = at;
+                    eventLog.log(EVENT_PYRO_ON, i);
+                }
+                if (event.offChannels & (1UL << i)) {
+                    this->offAt[i] = at;
+                    eventLog.log(EVENT_PYRO_OFF, i);
+                }
+            }
+            elapsed = micros() - this->startMicros;
+        }
+        if (!this->isFiring) {
+            return;
+        }
+        if (this->nextEvent < this->eventCount) {
+            this->timer.start(this->events[this->nextEvent].atMicros - elapsed);
+        }
+        else {
+            finish();
+        }
+    }
+
+    void finish() {
+        int32_t minError = INT32_MAX;
+        int32_t maxError = INT32_MIN;
+        for (int i = 0; i < N; i++) {
+            if (this->onAt[i] == UNSET) continue;
+            int32_t error = (int32_t)(this->onAt[i] - this->steps[i].delayMs * 1000);
+            if (error < minError) minError = error;
+            if (error > maxError) maxError = error;
+        }
+        this->skewMicros = maxError >= minError ? (uint32_t)(maxError - minError) : 0;
+        this->isFiring = false;
+        this->complete = true;
+    }
+
+    void writeOff(uint32_t mask) {
+        gpioWriteMask(Polarity::setMask(0, mask), Polarity::clearMask(0, mask));
+        writeUnmasked((1UL << N) - 1, false);
+    }
+
+    // Channels whose pin has no mask bit fall back to one digitalWrite each
+    void writeUnmasked(uint32_t channels, bool on) {
+        for (int i = 0; i < N; i++) {
+            if (!this->masks[i] && (channels & (1UL << i))) {
+                outputs.writeDigital(this->steps[i].pin, on ? Polarity::ON : Polarity::OFF);
+            }
+        }
+    }
+
+    static void ONESHOT_TIMER_IRAM onTimer(void* arg) {
+        PyroBank* bank = (PyroBank*)arg;
+        OneShotTimer::Lock lock(bank->timer);
+        bank->runDueEvents();
+    }
+
+    static size_t clampLen(int written, size_t size) {
+        if (written < 0) return 0;
+        return (size_t)written < size ? (size_t)written : size - 1;
+    }
+};
+
+#endif
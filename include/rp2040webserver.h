@@ -3,11 +3,12 @@
 
 #include <Arduino.h>    // For Serial, millis, delay, PROGMEM, F(), __FlashStringHelper
 #include <WiFiNINA.h>   // For WiFiServer, WiFiClient
-#include <functional>   // For std::function
-#include <vector>       // For std::vector
 #include <string.h>     // For C-string functions like strcmp, strcpy, strtok_r, strncpy, strchr, strlen
-#include <stdio.h>      // For snprintf, sscanf
+#include <strings.h>    // For strncasecmp, strcasecmp (header names are case-insensitive)
+#include <stdio.h>      // For snprintf, vsnprintf, sscanf
+#include <stdarg.h>     // For va_list (appendf)
 #include <avr/pgmspace.h> // For pgm_read_byte, strlen_P, strncpy_P (used in send_P)
+#include "websocket.h"  // For the WebSocket handshake and frame codec
 
 // --- Debug Configuration ---
 // Uncomment the next line to enable detailed SWS_DEBUG serial prints for troubleshooting
@@ -19,12 +20,22 @@
 #define SWS_MAX_URI_LENGTH 128          // Max length for the entire URI (path + query)
 #define SWS_MAX_PATH_LENGTH 64          // Max length for the path part of the URI
 #define SWS_MAX_QUERY_LENGTH 128        // Max length for the query string part
-#define SWS_MAX_HANDLER_PATH_LEN 64     // Max length for a registered handler's path
 #define SWS_MAX_ARGS 10                 // Max number of URL query arguments to parse
 #define SWS_MAX_ARG_KEY_LEN 32          // Max length for an argument key
 #define SWS_MAX_ARG_VALUE_LEN 64        // Max length for an argument value
-#define SWS_SEND_P_BUFFER_SIZE 64       // Buffer size for sending PROGMEM content in chunks
+#define SWS_SEND_CHUNK_SIZE 1024        // Max bytes per client write(); also the header assembly buffer
 #define SWS_STATUS_LINE_BUFFER_SIZE 80  // Buffer for constructing HTTP status lines
+#define SWS_EXTRA_HEADERS_BUFFER_SIZE 128 // Buffer for headers added with sendHeader()
+#define SWS_MAX_COLLECTED_HEADERS 2     // Request headers that collectHeaders() can keep
+#define SWS_MAX_HEADER_VALUE_LEN 48     // Max length kept of a collected header value
+#define SWS_KEEP_ALIVE_TIMEOUT_MS 5000  // Close a persistent connection after this long idle
+#define SWS_KEEP_ALIVE_MAX_REQUESTS 100 // Requests served on one connection before closing it
+#define SWS_MAX_CLIENTS 6               // Concurrent connections tracked in fixed slots
+#define SWS_MAX_EVENT_STREAMS 3         // Slots that may be held by Server-Sent Event streams
+#define SWS_MAX_WEBSOCKETS 2            // Slots that may be held by WebSocket connections
+#define SWS_RX_CHUNK_SIZE 64            // Bytes pulled from a client per read() call
+#define SWS_HANDLE_BUDGET_US 1000       // Max time handleClient() spends parsing per call
+#define SWS_REQUEST_TIMEOUT_MS 5000     // Max time for a client to deliver one request
 
 // Define SWS_MAX_URI_LENGTH_SCANF_VALUE as the literal number for sscanf width
 #define SWS_MAX_URI_LENGTH_SCANF_VALUE (SWS_MAX_URI_LENGTH - 1) // This will be e.g. 127
@@ -39,41 +50,107 @@ enum HTTP_METHOD_ENUM {
     HTTP_ANY, HTTP_GET, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS
 };
 
-class SimpleWebServer {
+// --- Compile-time Route Table ---
+// Routes are declared as a constexpr array and laid out at compile time in a
+// perfect-hash table: dispatch is one hash of the request path and a single
+// strcmp, whatever the number of routes, and the table lives in flash.
+//
+//   constexpr Route ROUTES[] = {
+//       { "/", HTTP_GET, []() { ... } },
+//       ...
+//   };
+//   constexpr RouteTable ROUTE_TABLE(ROUTES);
+//   static_assert(ROUTE_TABLE.valid(), "Route paths must be unique");
+//   ...
+//   server.setRoutes(ROUTE_TABLE);
+
+#define SWS_ROUTE_SEED_TRIES 256        // Hash seeds tried when building a route table
+
+struct Route {
+    const char* path;
+    HTTP_METHOD_ENUM method;
+    void (*handler)();
+};
+
+// FNV-1a, with the seed folded into the offset basis. The low bits of a
+// multiply only depend on the low bits of its inputs, so the high half is
+// folded down before the table masks it.
+constexpr uint32_t swsRouteHash(const char* str, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ (seed * 16777619u);
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+constexpr size_t swsNextPow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+// Type-erased view of a RouteTable, so the server does not depend on its size.
+struct RouteTableView {
+    const Route* slots;
+    uint32_t mask;
+    uint32_t seed;
+};
+
+template <size_t N>
+class RouteTable {
 public:
-    SimpleWebServer(uint16_t port = 80) : _wifiServer(port) {
-        _currentUri[0] = '\0';
-        _currentPath[0] = '\0';
-        _empty_string[0] = '\0';
+    static constexpr size_t SIZE = swsNextPow2(2 * N);
+
+    // Searches for a seed that maps every path to its own slot. Duplicate paths
+    // can never be placed, which leaves the table invalid.
+    constexpr RouteTable(const Route (&routes)[N]) : _slots(), _seed(0), _valid(false) {
+        for (uint32_t seed = 0; seed < SWS_ROUTE_SEED_TRIES && !_valid; seed++) {
+            _seed = seed;
+            _valid = build(routes, seed);
+        }
     }
 
-    void on(const char* path, HTTP_METHOD_ENUM method, std::function<void()> callback) {
-        if (!path || strlen(path) >= SWS_MAX_HANDLER_PATH_LEN) {
-        #ifdef SWS_ENABLE_DEBUG_PRINTING
-            Serial.println(F("SWS_DEBUG: Handler path too long or null, not adding."));
-        #endif
-            return;
+    constexpr bool valid() const {
+        return _valid;
+    }
+
+    constexpr RouteTableView view() const {
+        return RouteTableView{ _slots, (uint32_t)(SIZE - 1), _seed };
+    }
+
+private:
+    Route _slots[SIZE];
+    uint32_t _seed;
+    bool _valid;
+
+    constexpr bool build(const Route (&routes)[N], uint32_t seed) {
+        for (size_t i = 0; i < SIZE; i++) {
+            _slots[i] = Route{ nullptr, HTTP_ANY, nullptr };
         }
-        if (_handlers.size() >= 20) {
-        #ifdef SWS_ENABLE_DEBUG_PRINTING
-            Serial.println(F("SWS_DEBUG: Max handlers reached. Cannot add more."));
-        #endif
-            return;
+        for (size_t i = 0; i < N; i++) {
+            size_t index = swsRouteHash(routes[i].path, seed) & (SIZE - 1);
+            if (_slots[index].path) {
+                return false;
+            }
+            _slots[index] = routes[i];
         }
-        RequestHandler handler;
-        strncpy(handler.path, path, SWS_MAX_HANDLER_PATH_LEN - 1);
-        handler.path[SWS_MAX_HANDLER_PATH_LEN - 1] = '\0';
-        handler.method = method;
-        handler.callback = callback;
-        _handlers.push_back(handler);
+        return true;
     }
+};
 
-    void onGet(const char* path, std::function<void()> callback) {
-        on(path, HTTP_GET, callback);
+class SimpleWebServer {
+public:
+    SimpleWebServer(uint16_t port = 80) : _wifiServer(port) {
+        _currentUri[0] = '\0';
+        _currentPath[0] = '\0';
+        _empty_string[0] = '\0';
     }
 
-    void onPost(const char* path, std::function<void()> callback) {
-        on(path, HTTP_POST, callback);
+    // Installs the compile-time route table (see RouteTable above).
+    template <size_t N>
+    void setRoutes(const RouteTable<N>& table) {
+        _routes = table.view();
     }
 
     void begin() {
@@ -82,8 +159,8 @@ public:
 
     bool hasArg(const char* name) {
         if (!name) return false;
-        for (const auto& arg : _currentArgs) {
-            if (strcmp(arg.key, name) == 0) {
+        for (int i = 0; i < _currentArgCount; i++) {
+            if (strcmp(_currentArgs[i].key, name) == 0) {
                 return true;
             }
         }
@@ -92,278 +169,283 @@ public:
 
     const char* arg(const char* name) {
         if (!name) return _empty_string;
-        for (const auto& argument : _currentArgs) {
-            if (strcmp(argument.key, name) == 0) {
-                return argument.value;
+        for (int i = 0; i < _currentArgCount; i++) {
+            if (strcmp(_currentArgs[i].key, name) == 0) {
+                return _currentArgs[i].value;
             }
         }
         return _empty_string;
     }
 
     const char* arg(int i) {
-        if (i >= 0 && (size_t)i < _currentArgs.size()) {
+        if (i >= 0 && i < _currentArgCount) {
             return _currentArgs[i].value;
         }
         return _empty_string;
     }
 
     int args() {
-        return _currentArgs.size();
+        return _currentArgCount;
     }
 
     const char* argName(int i) {
-        if (i >= 0 && (size_t)i < _currentArgs.size()) {
+        if (i >= 0 && i < _currentArgCount) {
             return _currentArgs[i].key;
         }
         return _empty_string;
     }
 
+    // Services every connection without blocking. Each call accepts at most one new
+    // client, parses only the bytes already received (within SWS_HANDLE_BUDGET_US),
+    // and dispatches at most one complete request, so loop() always gets control back
+    // promptly whatever the clients send.
     void handleClient() {
-        WiFiClient client = _wifiServer.available();
-        if (client) {
-            _currentClient = client;
-            resetRequestState();
-
-            char requestLineBuffer[SWS_REQUEST_BUFFER_SIZE];
-            int bufferIdx = 0;
-            bool firstLineRead = false;
-            unsigned long requestStartTime = millis();
-
-        #ifdef SWS_ENABLE_DEBUG_PRINTING
-            Serial.println(F("SWS_DEBUG: New client connected. Reading request..."));
-        #endif
-
-            while (_currentClient.connected()) {
-                if (millis() - requestStartTime > 5000) {
-                    Serial.println(F("SWS: Client request timeout."));
-                    _currentClient.stop();
-                    return;
-                }
-
-                if (_currentClient.available()) {
-                    char c = _currentClient.read();
-                    if (c == '\n') {
-                        requestLineBuffer[bufferIdx] = '\0';
-                        if (!firstLineRead) {
-                        #ifdef SWS_ENABLE_DEBUG_PRINTING
-                            Serial.print(F("SWS_DEBUG: Attempting to parse request line: ["));
-                            Serial.print(requestLineBuffer);
-                            Serial.println(F("]"));
-                        #endif
-                            parseRequestLine(requestLineBuffer);
-                            firstLineRead = true;
-                        }
-                        else if (bufferIdx == 0) {
-                        #ifdef SWS_ENABLE_DEBUG_PRINTING
-                            Serial.println(F("SWS_DEBUG: End of headers detected."));
-                        #endif
-                            break;
-                        }
-                        bufferIdx = 0;
-                    }
-                    else if (c != '\r') {
-                        if (bufferIdx < SWS_REQUEST_BUFFER_SIZE - 1) {
-                            requestLineBuffer[bufferIdx++] = c;
-                        }
-                        else {
-                            Serial.println(F("SWS: Request line buffer overflow."));
-                            send(413, "text/plain", "Request line too long.");
-                            _currentClient.stop();
-                            return;
-                        }
-                    }
-                }
+        unsigned long start = micros();
+        acceptClient();
+
+        bool dispatched = false;
+        for (int n = 0; n < SWS_MAX_CLIENTS; n++) {
+            ClientSlot& slot = _slots[(_nextSlot + n) % SWS_MAX_CLIENTS];
+            if (slot.state == SLOT_FREE) {
+                continue;
             }
-
-            if (!firstLineRead && !_currentClient.connected()) {
-                Serial.println(F("SWS: Client disconnected before request line."));
-                return;
+            if (slot.state == SLOT_STREAM) {
+                expireSlot(slot);
+                continue;
             }
-
-            bool handlerFound = false;
-            if (_currentPath[0] != '\0') {
-            #ifdef SWS_ENABLE_DEBUG_PRINTING
-                Serial.print(F("SWS_DEBUG: Searching handler for path: ["));
-                Serial.print(_currentPath);
-                Serial.print(F("] Method: "));
-                Serial.println(_currentMethod);
-            #endif
-                for (const auto& handler : _handlers) {
-                    if ((handler.method == _currentMethod || handler.method == HTTP_ANY) &&
-                        (strcmp(handler.path, _currentPath) == 0)) {
-                    #ifdef SWS_ENABLE_DEBUG_PRINTING
-                        Serial.print(F("SWS_DEBUG: Handler found for path: ["));
-                        Serial.print(handler.path);
-                        Serial.println(F("]. Executing."));
-                    #endif
-                        handler.callback();
-                        handlerFound = true;
-                        break;
-                    }
+            if (slot.state == SLOT_WEBSOCKET) {
+                if (micros() - start < SWS_HANDLE_BUDGET_US) {
+                    readWebSocket(slot, start);
                 }
+                expireSlot(slot);
+                continue;
             }
-            else if (firstLineRead) {
-                Serial.println(F("SWS: Request line parsed but no valid path determined."));
+            if (micros() - start < SWS_HANDLE_BUDGET_US) {
+                readSlot(slot, start);
             }
-
-
-            if (!handlerFound) {
-                if (firstLineRead) {
-                #ifdef SWS_ENABLE_DEBUG_PRINTING
-                    Serial.print(F("SWS_DEBUG: No handler found for URI: ["));
-                    Serial.print(_currentUri);
-                    Serial.println(F("]. Sending 404."));
-                #endif
-                    char message404[SWS_MAX_URI_LENGTH + 20];
-                    snprintf(message404, sizeof(message404), "Not Found: %s", _currentUri[0] != '\0' ? _currentUri : "unknown");
-                    send(404, "text/plain", message404);
-                }
-                else if (_currentClient.connected()) {
-                #ifdef SWS_ENABLE_DEBUG_PRINTING
-                    Serial.println(F("SWS_DEBUG: No request line read, but client connected. Sending 400."));
-                #endif
-                    send(400, "text/plain", "Bad Request");
-                }
+            if (slot.state == SLOT_READY && !dispatched) {
+                dispatch(slot);
+                dispatched = true;
             }
-
-            if (_currentClient.connected()) {
-                _currentClient.stop();
-            #ifdef SWS_ENABLE_DEBUG_PRINTING
-                Serial.println(F("SWS_DEBUG: Client disconnected by server."));
-            #endif
+            else if (slot.state != SLOT_READY) {
+                expireSlot(slot);
             }
         }
+        _nextSlot = (_nextSlot + 1) % SWS_MAX_CLIENTS;
     }
 
-    void send(int httpStatusCode, const char* contentType, const char* content) {
-        if (!_currentClient || !_currentClient.connected()) {
-            return;
+    // Byte and write() counts for sent responses; each write() is one SPI
+    // transaction to the NINA module.
+    struct ResponseStats {
+        uint32_t responses = 0;
+        uint32_t bytes = 0;
+        uint32_t writeCalls = 0;
+        uint32_t lastBytes = 0;
+        uint32_t lastWriteCalls = 0;
+        uint32_t lastMicros = 0;
+    };
+
+    const ResponseStats& responseStats() {
+        return _responseStats;
+    }
+
+    // micros() when the last bytes of the current request (or WebSocket
+    // message) were read from the socket; for latency measurements.
+    uint32_t requestMicros() {
+        return _currentSlot ? _currentSlot->rxMicros : micros();
+    }
+
+    // Turns the current request's connection into a Server-Sent Event stream.
+    // Call from a route handler instead of send(); the connection then only
+    // receives frames passed to sendEvent().
+    bool beginEventStream() {
+        if (!_currentSlot || eventStreams() >= SWS_MAX_EVENT_STREAMS) {
+            send(503, "text/plain", "Too many event streams.");
+            return false;
         }
-        char statusLineBuf[SWS_STATUS_LINE_BUFFER_SIZE];
-        constructHttpStatusLine(httpStatusCode, statusLineBuf, sizeof(statusLineBuf));
-        _currentClient.println(statusLineBuf);
-        _currentClient.print(F("Content-Type: "));
-        _currentClient.println(contentType ? contentType : "application/octet-stream");
-        _currentClient.println(F("Connection: close"));
-        size_t contentLength = content ? strlen(content) : 0;
-        _currentClient.print(F("Content-Length: "));
-        _currentClient.println(contentLength);
-        _currentClient.println();
-        if (contentLength > 0) {
-            _currentClient.print(content);
+        static const char headers[] =
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: text/event-stream\r\n"
+            "Cache-Control: no-cache\r\n"
+            "Connection: keep-alive\r\n\r\n";
+        _currentClient.write((const uint8_t*)headers, sizeof(headers) - 1);
+        _currentSlot->state = SLOT_STREAM;
+        return true;
+    }
+
+    // Writes a complete SSE frame ("data: ...\n\n") to every open stream.
+    void sendEvent(const char* frame) {
+        size_t len = strlen(frame);
+        for (auto& slot : _slots) {
+            if (slot.state != SLOT_STREAM) {
+                continue;
+            }
+            if (!slot.client.connected() || slot.client.write((const uint8_t*)frame, len) != len) {
+                closeSlot(slot);
+            }
         }
-        _currentClient.flush();
     }
 
-    // Place these methods inside your SimpleWebServer class
+    typedef void (*WebSocketMessageHandler)(const uint8_t* data, size_t len);
 
-// Version 1: Content type is also from PROGMEM (e.g., using F("text/html"))
-    void send_P(int httpStatusCode, const __FlashStringHelper* contentTypeF, const char* progmemContent) {
-        if (!_currentClient || !_currentClient.connected()) {
-        #ifdef SWS_ENABLE_DEBUG_PRINTING
-            Serial.println(F("SWS_DEBUG: No client or client disconnected, cannot send_P (F() contentType)."));
-        #endif
-            return;
+    // Called for each text or binary message on any WebSocket; reply with sendWebSocket().
+    void onWebSocketMessage(WebSocketMessageHandler handler) {
+        _wsHandler = handler;
+    }
+
+    // Completes a WebSocket upgrade for the current request. Call from a route
+    // handler instead of send(); later frames go to onWebSocketMessage().
+    bool beginWebSocket() {
+        if (!_currentSlot || !_currentSlot->wsUpgrade || _currentSlot->wsKey[0] == '\0') {
+            _keepAlive = false;
+            send(400, "text/plain", "WebSocket upgrade required.");
+            return false;
+        }
+        if (webSockets() >= SWS_MAX_WEBSOCKETS) {
+            send(503, "text/plain", "Too many WebSockets.");
+            return false;
         }
+        int len = wsHandshakeResponse(_currentSlot->wsKey, _sendBuffer, sizeof(_sendBuffer));
+        _currentClient.write((const uint8_t*)_sendBuffer, len);
+        _currentSlot->ws.reset();
+        _currentSlot->state = SLOT_WEBSOCKET;
+        return true;
+    }
 
-        char statusLineBuf[SWS_STATUS_LINE_BUFFER_SIZE];
-        constructHttpStatusLine(httpStatusCode, statusLineBuf, sizeof(statusLineBuf));
-        _currentClient.println(statusLineBuf);
+    // Sends a binary message to the WebSocket whose message is being handled.
+    void sendWebSocket(const uint8_t* data, size_t len) {
+        sendWebSocketFrame(WS_OP_BINARY, data, len);
+    }
 
-        _currentClient.print(F("Content-Type: "));
-        if (contentTypeF) {
-            _currentClient.println(contentTypeF); // Print __FlashStringHelper directly
+    int webSockets() {
+        int count = 0;
+        for (const auto& slot : _slots) {
+            if (slot.state == SLOT_WEBSOCKET) count++;
         }
-        else {
-            _currentClient.println(F("application/octet-stream")); // Default if null
+        return count;
+    }
+
+    int eventStreams() {
+        int count = 0;
+        for (const auto& slot : _slots) {
+            if (slot.state == SLOT_STREAM) count++;
         }
-        _currentClient.println(F("Connection: close"));
+        return count;
+    }
 
-        size_t contentLength = 0;
-        if (progmemContent) {
-            contentLength = strlen_P(progmemContent);
+    int activeClients() {
+        int count = 0;
+        for (const auto& slot : _slots) {
+            if (slot.state != SLOT_FREE) count++;
         }
+        return count;
+    }
 
-        _currentClient.print(F("Content-Length: "));
-        _currentClient.println(contentLength);
-        _currentClient.println(); // Blank line signifies end of headers
+    void send(int httpStatusCode, const char* contentType, const char* content) {
+        writeResponse(httpStatusCode, contentType, content, content ? strlen(content) : 0);
+    }
 
-        if (contentLength > 0 && progmemContent) {
-            char buffer[64]; // No +1 needed for client.write
-            size_t sentBytes = 0;
-            while (sentBytes < contentLength) {
-                size_t chunkSize = min((size_t)64, contentLength - sentBytes);
-                // Copy from PROGMEM to RAM buffer
-                memcpy_P(buffer, progmemContent + sentBytes, chunkSize);
-                // Send the exact number of bytes from the RAM buffer
-                _currentClient.write((const uint8_t*)buffer, chunkSize);
-                sentBytes += chunkSize;
-            }
-        }
-        _currentClient.flush(); // Ensure all data is sent
-    #ifdef SWS_ENABLE_DEBUG_PRINTING
-        Serial.println(F("SWS_DEBUG: send_P (F() contentType) completed."));
-    #endif
+    // Version 1: Content type is also from PROGMEM (e.g., using F("text/html"))
+    void send_P(int httpStatusCode, const __FlashStringHelper* contentTypeF, const char* progmemContent) {
+        send_P(httpStatusCode, reinterpret_cast<const char*>(contentTypeF), progmemContent);
     }
 
     // Version 2: Content type is a regular C-string (from RAM)
     void send_P(int httpStatusCode, const char* contentType, const char* progmemContent) {
+        send_P(httpStatusCode, contentType, progmemContent, progmemContent ? strlen_P(progmemContent) : 0);
+    }
+
+    // Version 3: Explicit length, for binary PROGMEM content such as gzipped pages
+    void send_P(int httpStatusCode, const char* contentType, const char* progmemContent, size_t contentLength) {
+        writeResponse(httpStatusCode, contentType, progmemContent, contentLength);
+    }
+
+    // Starts a response whose length is not known up front, for bodies too
+    // big to build in RAM; follow with sendContent() calls. The body ends
+    // when the connection closes, so it is not kept alive.
+    void beginContent(int httpStatusCode, const char* contentType) {
         if (!_currentClient || !_currentClient.connected()) {
-        #ifdef SWS_ENABLE_DEBUG_PRINTING
-            Serial.println(F("SWS_DEBUG: No client or client disconnected, cannot send_P (char* contentType)."));
-        #endif
+            _extraHeaders[0] = '\0';
             return;
         }
+        _keepAlive = false;
+        size_t len = appendHeaders(httpStatusCode, contentType);
+        appendf(_sendBuffer, len, "\r\n");
+        sendContent(_sendBuffer, len);
+        _responseStats.responses++;
+    }
 
-        char statusLineBuf[SWS_STATUS_LINE_BUFFER_SIZE];
-        constructHttpStatusLine(httpStatusCode, statusLineBuf, sizeof(statusLineBuf));
-        _currentClient.println(statusLineBuf);
+    // Writes part of a beginContent() body, in SWS_SEND_CHUNK_SIZE pieces.
+    void sendContent(const char* data, size_t len) {
+        if (!_currentClient) {
+            return;
+        }
+        for (size_t sent = 0; sent < len; ) {
+            size_t chunkSize = min((size_t)SWS_SEND_CHUNK_SIZE, len - sent);
+            size_t written = _currentClient.write((const uint8_t*)data + sent, chunkSize);
+            _responseStats.bytes += written;
+            _responseStats.writeCalls++;
+            if (written == 0) {
+                return; // Connection gone
+            }
+            sent += written;
+        }
+    }
 
-        _currentClient.print(F("Content-Type: "));
-        _currentClient.println(contentType ? contentType : "application/octet-stream");
-        _currentClient.println(F("Connection: close"));
+    // Adds a header to the next send()/send_P() response only.
+    void sendHeader(const char* name, const char* value) {
+        size_t len = strlen(_extraHeaders);
+        int n = snprintf(_extraHeaders + len, sizeof(_extraHeaders) - len, "%s: %s\r\n", name, value);
+        if (n < 0 || (size_t)n >= sizeof(_extraHeaders) - len) {
+            _extraHeaders[len] = '\0'; // Drop a header that does not fit rather than truncate it
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.println(F("SWS_DEBUG: Extra header buffer full, header dropped."));
+        #endif
+        }
+    }
 
-        size_t contentLength = 0;
-        if (progmemContent) {
-            contentLength = strlen_P(progmemContent);
+    // Request headers are discarded unless their names are registered here
+    // (names are not copied, so pass string literals).
+    void collectHeaders(const char* headerKeys[], size_t headerKeysCount) {
+        _collectedHeaderCount = min(headerKeysCount, (size_t)SWS_MAX_COLLECTED_HEADERS);
+        for (size_t i = 0; i < _collectedHeaderCount; i++) {
+            _collectedHeaderNames[i] = headerKeys[i];
         }
+    }
 
-        _currentClient.print(F("Content-Length: "));
-        _currentClient.println(contentLength);
-        _currentClient.println(); // Blank line
+    bool hasHeader(const char* name) {
+        return header(name)[0] != '\0';
+    }
 
-        if (contentLength > 0 && progmemContent) {
-            char buffer[128]; // No +1 needed for client.write
-            size_t sentBytes = 0;
-            while (sentBytes < contentLength) {
-                size_t chunkSize = min((size_t)64, contentLength - sentBytes);
-                memcpy_P(buffer, progmemContent + sentBytes, chunkSize);
-                _currentClient.write((const uint8_t*)buffer, chunkSize);
-                sentBytes += chunkSize;
+    const char* header(const char* name) {
+        if (!_currentSlot || !name) return _empty_string;
+        for (size_t i = 0; i < _collectedHeaderCount; i++) {
+            if (strcasecmp(_collectedHeaderNames[i], name) == 0) {
+                return _currentSlot->headerValues[i];
             }
         }
-        _currentClient.flush();
-    #ifdef SWS_ENABLE_DEBUG_PRINTING
-        Serial.println(F("SWS_DEBUG: send_P (char* contentType) completed."));
-    #endif
+        return _empty_string;
     }
 
 private:
     WiFiServer _wifiServer;
-    WiFiClient _currentClient;
+    WiFiClient _currentClient;          // Connection of the request being dispatched
+    uint16_t _requestsOnConnection = 0;
+    bool _keepAlive = true;
+    char _extraHeaders[SWS_EXTRA_HEADERS_BUFFER_SIZE] = "";
+    ResponseStats _responseStats;
+    char _sendBuffer[SWS_SEND_CHUNK_SIZE];
+    const char* _collectedHeaderNames[SWS_MAX_COLLECTED_HEADERS];
+    size_t _collectedHeaderCount = 0;
 
     struct RequestArgument {
         char key[SWS_MAX_ARG_KEY_LEN];
         char value[SWS_MAX_ARG_VALUE_LEN];
     };
-    std::vector<RequestArgument> _currentArgs;
+    RequestArgument _currentArgs[SWS_MAX_ARGS];
+    int _currentArgCount = 0;
 
-    struct RequestHandler {
-        char path[SWS_MAX_HANDLER_PATH_LEN];
-        HTTP_METHOD_ENUM method;
-        std::function<void()> callback;
-    };
-    std::vector<RequestHandler> _handlers;
+    RouteTableView _routes = { nullptr, 0, 0 };
 
     char _currentUri[SWS_MAX_URI_LENGTH];
     char _currentPath[SWS_MAX_PATH_LENGTH];
@@ -371,11 +453,509 @@ private:
 
     static char _empty_string[1];
 
+    // --- Connection Slots ---
+    // Each connection is parsed incrementally; a slot remembers where it left off.
+    enum SlotState {
+        SLOT_FREE,          // No connection
+        SLOT_REQUEST_LINE,  // Waiting for (or reading) a request line
+        SLOT_HEADERS,       // Reading header lines
+        SLOT_BODY,          // Discarding a Content-Length body
+        SLOT_READY,         // Complete request waiting to be dispatched
+        SLOT_STREAM,        // Server-Sent Event stream; incoming bytes are ignored
+        SLOT_WEBSOCKET      // Upgraded connection; bytes are WebSocket frames
+    };
+
+    struct ClientSlot {
+        WiFiClient client;
+        SlotState state = SLOT_FREE;
+        char line[SWS_REQUEST_BUFFER_SIZE];
+        uint16_t lineLen = 0;
+        char requestLine[SWS_REQUEST_BUFFER_SIZE];
+        uint8_t rx[SWS_RX_CHUNK_SIZE];  // Received but not yet parsed; may hold a pipelined request
+        uint8_t rxPos = 0;
+        uint8_t rxLen = 0;
+        bool keepAlive = true;
+        bool overflow = false;
+        size_t bodyRemaining = 0;
+        uint16_t requests = 0;
+        char headerValues[SWS_MAX_COLLECTED_HEADERS][SWS_MAX_HEADER_VALUE_LEN];
+        char wsKey[WS_KEY_LENGTH];      // Sec-WebSocket-Key of the current request
+        bool wsUpgrade = false;         // Request asked for "Upgrade: websocket"
+        WsFrameParser ws;
+        unsigned long requestStart = 0;
+        unsigned long lastActivity = 0;
+        uint32_t rxMicros = 0;          // When rx was last filled
+    };
+
+    ClientSlot _slots[SWS_MAX_CLIENTS];
+    ClientSlot* _currentSlot = nullptr; // Slot of the request being dispatched
+    WebSocketMessageHandler _wsHandler = nullptr;
+    int _nextSlot = 0;
+
+    void acceptClient() {
+        WiFiClient client = _wifiServer.available();
+        if (!client) {
+            return;
+        }
+        ClientSlot* freeSlot = nullptr;
+        ClientSlot* idleSlot = nullptr;
+        for (auto& slot : _slots) {
+            if (slot.state == SLOT_FREE) {
+                if (!freeSlot) freeSlot = &slot;
+            }
+            else if (slot.client == client) {
+                return; // NINA reports sockets we already hold when they have data
+            }
+            else if (isIdle(slot) && (!idleSlot || slot.lastActivity < idleSlot->lastActivity)) {
+                idleSlot = &slot;
+            }
+        }
+        if (!freeSlot && idleSlot) {
+            // A new client preempts the longest-idle keep-alive connection;
+            // browsers transparently retry on a fresh socket.
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.println(F("SWS_DEBUG: New client preempts idle keep-alive connection."));
+        #endif
+            closeSlot(*idleSlot);
+            freeSlot = idleSlot;
+        }
+        if (!freeSlot) {
+            Serial.println(F("SWS: All client slots busy."));
+            _currentClient = client;
+            _keepAlive = false;
+            send(503, "text/plain", "Server busy.");
+            client.stop();
+            _currentClient = WiFiClient();
+            return;
+        }
+        freeSlot->client = client;
+        freeSlot->requests = 0;
+        freeSlot->rxPos = 0;
+        freeSlot->rxLen = 0;
+        freeSlot->lastActivity = millis();
+        startRequest(*freeSlot);
+    #ifdef SWS_ENABLE_DEBUG_PRINTING
+        Serial.println(F("SWS_DEBUG: New client connected."));
+    #endif
+    }
+
+    void startRequest(ClientSlot& slot) {
+        slot.state = SLOT_REQUEST_LINE;
+        slot.lineLen = 0;
+        slot.keepAlive = true;
+        slot.overflow = false;
+        slot.bodyRemaining = 0;
+        for (auto& value : slot.headerValues) {
+            value[0] = '\0';
+        }
+        slot.wsKey[0] = '\0';
+        slot.wsUpgrade = false;
+    }
+
+    void closeSlot(ClientSlot& slot) {
+        slot.client.stop();
+        slot.client = WiFiClient();
+        slot.state = SLOT_FREE;
+    }
+
+    bool isIdle(const ClientSlot& slot) {
+        return slot.state == SLOT_REQUEST_LINE && slot.lineLen == 0 && slot.rxPos == slot.rxLen;
+    }
+
+    // Refills an empty receive buffer with one read() call; false if nothing is waiting.
+    bool fillRx(ClientSlot& slot) {
+        if (slot.rxPos < slot.rxLen) {
+            return true;
+        }
+        int available = slot.client.available();
+        if (available <= 0) {
+            return false;
+        }
+        int n = slot.client.read(slot.rx, min((size_t)available, sizeof(slot.rx)));
+        if (n <= 0) {
+            return false;
+        }
+        slot.rxPos = 0;
+        slot.rxLen = n;
+        slot.rxMicros = micros();
+        slot.lastActivity = millis();
+        return true;
+    }
+
+    // Parses buffered bytes, refilling the buffer in SWS_RX_CHUNK_SIZE reads,
+    // until the request is complete, nothing more is available or the budget runs out.
+    void readSlot(ClientSlot& slot, unsigned long start) {
+        while (slot.state != SLOT_READY && micros() - start < SWS_HANDLE_BUDGET_US) {
+            if (!fillRx(slot)) {
+                return;
+            }
+            while (slot.rxPos < slot.rxLen && slot.state != SLOT_READY) {
+                consume(slot, slot.rx[slot.rxPos++]);
+            }
+        }
+    }
+
+    void readWebSocket(ClientSlot& slot, unsigned long start) {
+        while (slot.state == SLOT_WEBSOCKET && micros() - start < SWS_HANDLE_BUDGET_US) {
+            if (!fillRx(slot)) {
+                return;
+            }
+            WsFrameParser::Result result = slot.ws.feed(slot.rx[slot.rxPos++]);
+            if (result == WsFrameParser::WS_ERROR) {
+                Serial.println(F("SWS: WebSocket protocol error, closing."));
+                closeSlot(slot);
+            }
+            else if (result == WsFrameParser::WS_MESSAGE) {
+                handleWebSocketFrame(slot);
+            }
+        }
+    }
+
+    void handleWebSocketFrame(ClientSlot& slot) {
+        _currentClient = slot.client;
+        _currentSlot = &slot;
+        switch (slot.ws.opcode()) {
+            case WS_OP_TEXT:
+            case WS_OP_BINARY:
+                if (_wsHandler) {
+                    _wsHandler(slot.ws.payload(), slot.ws.length());
+                }
+                break;
+            case WS_OP_PING:
+                sendWebSocketFrame(WS_OP_PONG, slot.ws.payload(), slot.ws.length());
+                break;
+            case WS_OP_CLOSE:
+                sendWebSocketFrame(WS_OP_CLOSE, slot.ws.payload(), min(slot.ws.length(), (size_t)2));
+                closeSlot(slot);
+                break;
+            default:
+                break;
+        }
+        _currentClient = WiFiClient();
+        _currentSlot = nullptr;
+    }
+
+    void sendWebSocketFrame(uint8_t opcode, const uint8_t* data, size_t len) {
+        if (!_currentClient || len > sizeof(_sendBuffer) - WS_MAX_FRAME_HEADER) {
+            return;
+        }
+        size_t frameLen = wsEncodeFrame(opcode, data, len, (uint8_t*)_sendBuffer);
+        _currentClient.write((const uint8_t*)_sendBuffer, frameLen);
+    }
+
+    void consume(ClientSlot& slot, char c) {
+        if (slot.state == SLOT_BODY) {
+            if (--slot.bodyRemaining == 0) {
+                slot.state = SLOT_READY;
+            }
+            return;
+        }
+        if (c == '\r') {
+            return;
+        }
+        if (c != '\n') {
+            if (slot.state == SLOT_REQUEST_LINE && slot.lineLen == 0) {
+                slot.requestStart = millis();
+            }
+            if (slot.lineLen < SWS_REQUEST_BUFFER_SIZE - 1) {
+                slot.line[slot.lineLen++] = c;
+            }
+            else {
+                slot.overflow = true;
+                slot.state = SLOT_READY;
+            }
+            return;
+        }
+
+        slot.line[slot.lineLen] = '\0';
+        if (slot.state == SLOT_REQUEST_LINE) {
+            if (slot.lineLen > 0) {
+                memcpy(slot.requestLine, slot.line, slot.lineLen + 1);
+                // HTTP/1.0 closes unless it asks for keep-alive
+                if (slot.lineLen >= 8 && strcmp(slot.line + slot.lineLen - 8, "HTTP/1.0") == 0) {
+                    slot.keepAlive = false;
+                }
+                slot.state = SLOT_HEADERS;
+            }
+            // else: tolerate stray CRLF between pipelined requests
+        }
+        else if (slot.lineLen == 0) {
+            slot.state = slot.bodyRemaining > 0 ? SLOT_BODY : SLOT_READY;
+        }
+        else {
+            parseHeaderLine(slot, slot.line);
+        }
+        slot.lineLen = 0;
+    }
+
+    // Closes connections the peer dropped, that sat idle past the keep-alive timeout,
+    // or that are taking too long to deliver a request.
+    void expireSlot(ClientSlot& slot) {
+        if (slot.state == SLOT_FREE) {
+            return;
+        }
+        if (slot.state == SLOT_WEBSOCKET) {
+            if (slot.rxPos == slot.rxLen && !slot.client.available() && !slot.client.connected()) {
+            #ifdef SWS_ENABLE_DEBUG_PRINTING
+                Serial.println(F("SWS_DEBUG: WebSocket closed."));
+            #endif
+                closeSlot(slot);
+            }
+        }
+        else if (slot.state == SLOT_STREAM) {
+            if (slot.client.available()) {
+                slot.client.read(slot.rx, sizeof(slot.rx)); // Nothing is expected; keep the socket drained
+            }
+            else if (!slot.client.connected()) {
+            #ifdef SWS_ENABLE_DEBUG_PRINTING
+                Serial.println(F("SWS_DEBUG: Event stream closed."));
+            #endif
+                closeSlot(slot);
+            }
+        }
+        else if (slot.rxPos == slot.rxLen && !slot.client.connected()) {
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.println(F("SWS_DEBUG: Client closed the connection."));
+        #endif
+            closeSlot(slot);
+        }
+        else if (isIdle(slot)) {
+            if (millis() - slot.lastActivity > SWS_KEEP_ALIVE_TIMEOUT_MS) {
+            #ifdef SWS_ENABLE_DEBUG_PRINTING
+                Serial.println(F("SWS_DEBUG: Keep-alive idle timeout, closing."));
+            #endif
+                closeSlot(slot);
+            }
+        }
+        else if (millis() - slot.requestStart > SWS_REQUEST_TIMEOUT_MS) {
+            Serial.println(F("SWS: Client request timeout."));
+            _currentClient = slot.client;
+            _keepAlive = false;
+            send(408, "text/plain", "Request timeout.");
+            _currentClient = WiFiClient();
+            closeSlot(slot);
+        }
+    }
+
+    void dispatch(ClientSlot& slot) {
+        _currentClient = slot.client;
+        _currentSlot = &slot;
+        resetRequestState();
+        _requestsOnConnection = ++slot.requests;
+        _keepAlive = slot.keepAlive && _requestsOnConnection < SWS_KEEP_ALIVE_MAX_REQUESTS;
+
+        if (slot.overflow) {
+            Serial.println(F("SWS: Request line buffer overflow."));
+            _keepAlive = false;
+            send(413, "text/plain", "Request line too long.");
+        }
+        else {
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.print(F("SWS_DEBUG: Attempting to parse request line: ["));
+            Serial.print(slot.requestLine);
+            Serial.println(F("]"));
+        #endif
+            parseRequestLine(slot.requestLine);
+            routeRequest();
+        }
+
+        slot.lastActivity = millis();
+        if (slot.state == SLOT_STREAM || slot.state == SLOT_WEBSOCKET) {
+            // Handed over to sendEvent() / onWebSocketMessage()
+        }
+        else if (_keepAlive) {
+            startRequest(slot);
+        }
+        else {
+            closeSlot(slot);
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.println(F("SWS_DEBUG: Client disconnected by server."));
+        #endif
+        }
+        _currentClient = WiFiClient();
+        _currentSlot = nullptr;
+    }
+
+    void routeRequest() {
+        bool handlerFound = false;
+        if (_currentPath[0] != '\0') {
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.print(F("SWS_DEBUG: Searching handler for path: ["));
+            Serial.print(_currentPath);
+            Serial.print(F("] Method: "));
+            Serial.println(_currentMethod);
+        #endif
+            const Route* route = findRoute(_currentPath);
+            if (route && (route->method == _currentMethod || route->method == HTTP_ANY)) {
+            #ifdef SWS_ENABLE_DEBUG_PRINTING
+                Serial.print(F("SWS_DEBUG: Handler found for path: ["));
+                Serial.print(route->path);
+                Serial.println(F("]. Executing."));
+            #endif
+                route->handler();
+                handlerFound = true;
+            }
+        }
+        else {
+            Serial.println(F("SWS: Request line parsed but no valid path determined."));
+        }
+
+        if (!handlerFound) {
+            if (_currentUri[0] != '\0') {
+            #ifdef SWS_ENABLE_DEBUG_PRINTING
+                Serial.print(F("SWS_DEBUG: No handler found for URI: ["));
+                Serial.print(_currentUri);
+                Serial.println(F("]. Sending 404."));
+            #endif
+                char message404[SWS_MAX_URI_LENGTH + 20];
+                snprintf(message404, sizeof(message404), "Not Found: %s", _currentUri);
+                send(404, "text/plain", message404);
+            }
+            else {
+                _keepAlive = false;
+                send(400, "text/plain", "Bad Request");
+            }
+        }
+    }
+
+    const Route* findRoute(const char* path) {
+        if (!_routes.slots) return nullptr;
+        const Route& route = _routes.slots[swsRouteHash(path, _routes.seed) & _routes.mask];
+        if (route.path && strcmp(route.path, path) == 0) {
+            return &route;
+        }
+        return nullptr;
+    }
+
     void resetRequestState() {
-        _currentArgs.clear();
+        _currentArgCount = 0;
         _currentUri[0] = '\0';
         _currentPath[0] = '\0';
         _currentMethod = HTTP_ANY;
+        _extraHeaders[0] = '\0';
+    }
+
+    // Picks up the headers that affect connection handling and those registered
+    // with collectHeaders(); everything else is ignored.
+    void parseHeaderLine(ClientSlot& slot, const char* line) {
+        if (strncasecmp(line, "Connection:", 11) == 0) {
+            const char* value = line + 11;
+            while (*value == ' ') value++;
+            if (strncasecmp(value, "close", 5) == 0) {
+                slot.keepAlive = false;
+            }
+            else if (strncasecmp(value, "keep-alive", 10) == 0) {
+                slot.keepAlive = true;
+            }
+        }
+        else if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            slot.bodyRemaining = strtoul(line + 15, NULL, 10);
+        }
+        else if (strncasecmp(line, "Upgrade:", 8) == 0) {
+            slot.wsUpgrade = strcasestr(line + 8, "websocket") != NULL;
+        }
+        else if (strncasecmp(line, "Sec-WebSocket-Key:", 18) == 0) {
+            const char* value = line + 18;
+            while (*value == ' ') value++;
+            strncpy(slot.wsKey, value, WS_KEY_LENGTH - 1);
+            slot.wsKey[WS_KEY_LENGTH - 1] = '\0';
+        }
+        else {
+            const char* colon = strchr(line, ':');
+            if (!colon) return;
+            size_t nameLen = colon - line;
+            for (size_t i = 0; i < _collectedHeaderCount; i++) {
+                if (strlen(_collectedHeaderNames[i]) == nameLen &&
+                    strncasecmp(_collectedHeaderNames[i], line, nameLen) == 0) {
+                    const char* value = colon + 1;
+                    while (*value == ' ') value++;
+                    strncpy(slot.headerValues[i], value, SWS_MAX_HEADER_VALUE_LEN - 1);
+                    slot.headerValues[i][SWS_MAX_HEADER_VALUE_LEN - 1] = '\0';
+                    break;
+                }
+            }
+        }
+    }
+
+    // --- Response Writer ---
+    // Every client write() is one SPI command to the NINA module, so a response is
+    // assembled into as few writes as possible: the status line, headers and the
+    // start of the body go out together from one buffer, and the rest of the body
+    // is written in SWS_SEND_CHUNK_SIZE pieces straight from flash. (Flash is
+    // memory-mapped on both supported boards, so no memcpy_P staging is needed.)
+    void writeResponse(int httpStatusCode, const char* contentType, const char* body, size_t bodyLength) {
+        if (!_currentClient || !_currentClient.connected()) {
+        #ifdef SWS_ENABLE_DEBUG_PRINTING
+            Serial.println(F("SWS_DEBUG: No client or client disconnected, cannot send."));
+        #endif
+            _extraHeaders[0] = '\0';
+            return;
+        }
+        unsigned long start = micros();
+        if (!body) {
+            bodyLength = 0;
+        }
+
+        char* buffer = _sendBuffer;
+        size_t len = appendHeaders(httpStatusCode, contentType);
+        appendf(buffer, len, "Content-Length: %u\r\n\r\n", (unsigned int)bodyLength);
+
+        uint32_t writeCalls = 0;
+        size_t written = 0;
+        size_t sentBody = min(bodyLength, (size_t)SWS_SEND_CHUNK_SIZE - len);
+        memcpy(buffer + len, body, sentBody);
+        written += _currentClient.write((const uint8_t*)buffer, len + sentBody);
+        writeCalls++;
+        while (sentBody < bodyLength) {
+            size_t chunkSize = min((size_t)SWS_SEND_CHUNK_SIZE, bodyLength - sentBody);
+            written += _currentClient.write((const uint8_t*)body + sentBody, chunkSize);
+            writeCalls++;
+            sentBody += chunkSize;
+        }
+        _currentClient.flush();
+
+        _responseStats.responses++;
+        _responseStats.bytes += written;
+        _responseStats.writeCalls += writeCalls;
+        _responseStats.lastBytes = written;
+        _responseStats.lastWriteCalls = writeCalls;
+        _responseStats.lastMicros = micros() - start;
+    #ifdef SWS_ENABLE_DEBUG_PRINTING
+        Serial.print(F("SWS_DEBUG: Sent ")); Serial.print(written);
+        Serial.print(F(" bytes in ")); Serial.print(writeCalls);
+        Serial.print(F(" writes, ")); Serial.print(_responseStats.lastMicros); Serial.println(F(" us."));
+    #endif
+    }
+
+    // Status line, Content-Type, sendHeader() headers and Connection into
+    // _sendBuffer; returns their length. The caller ends the header block.
+    size_t appendHeaders(int httpStatusCode, const char* contentType) {
+        size_t len = 0;
+        char statusLineBuf[SWS_STATUS_LINE_BUFFER_SIZE];
+        constructHttpStatusLine(httpStatusCode, statusLineBuf, sizeof(statusLineBuf));
+        appendf(_sendBuffer, len, "%s\r\nContent-Type: %s\r\n%s", statusLineBuf,
+            contentType ? contentType : "application/octet-stream", _extraHeaders);
+        _extraHeaders[0] = '\0';
+        if (_keepAlive) {
+            appendf(_sendBuffer, len, "Connection: keep-alive\r\nKeep-Alive: timeout=%d, max=%d\r\n",
+                SWS_KEEP_ALIVE_TIMEOUT_MS / 1000, SWS_KEEP_ALIVE_MAX_REQUESTS - _requestsOnConnection);
+        }
+        else {
+            appendf(_sendBuffer, len, "Connection: close\r\n");
+        }
+        return len;
+    }
+
+    // Appends to a SWS_SEND_CHUNK_SIZE buffer, keeping len within it.
+    __attribute__((format(printf, 3, 4)))
+    static void appendf(char* buffer, size_t& len, const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buffer + len, SWS_SEND_CHUNK_SIZE - len, format, args);
+        va_end(args);
+        if (n > 0) {
+            len = min(len + n, (size_t)SWS_SEND_CHUNK_SIZE - 1);
+        }
     }
 
     void constructHttpStatusLine(int code, char* buffer, size_t bufferSize) {
@@ -384,12 +964,16 @@ private:
             case 200: statusText = "OK"; break;
             case 201: statusText = "Created"; break;
             case 204: statusText = "No Content"; break;
+            case 304: statusText = "Not Modified"; break;
             case 400: statusText = "Bad Request"; break;
             case 401: statusText = "Unauthorized"; break;
             case 403: statusText = "Forbidden"; break;
             case 404: statusText = "Not Found"; break;
+            case 408: statusText = "Request Timeout"; break;
+            case 409: statusText = "Conflict"; break;
             case 413: statusText = "Payload Too Large"; break;
             case 500: statusText = "Internal Server Error"; break;
+            case 503: statusText = "Service Unavailable"; break;
             default:  statusText = "Status"; break;
         }
         snprintf(buffer, bufferSize, "HTTP/1.1 %d %s", code, statusText);
@@ -526,7 +1110,7 @@ private:
 
     void parseArguments(const char* queryString) {
         if (!queryString || queryString[0] == '\0') return;
-        _currentArgs.clear();
+        _currentArgCount = 0;
         char queryCopy[SWS_MAX_QUERY_LENGTH];
         strncpy(queryCopy, queryString, SWS_MAX_QUERY_LENGTH - 1);
         queryCopy[SWS_MAX_QUERY_LENGTH - 1] = '\0';
@@ -536,7 +1120,7 @@ private:
         Serial.print(F("SWS_DEBUG_PARSE_ARGS: Parsing query: [")); Serial.print(queryString); Serial.println(F("]"));
     #endif
         while ((pairToken = strtok_r(restPairs, "&", &restPairs)) != NULL) {
-            if (_currentArgs.size() >= SWS_MAX_ARGS) {
+            if (_currentArgCount >= SWS_MAX_ARGS) {
             #ifdef SWS_ENABLE_DEBUG_PRINTING
                 Serial.println(F("SWS_DEBUG_PARSE_ARGS: Max args reached."));
             #endif
@@ -545,7 +1129,7 @@ private:
             char* restValue = pairToken;
             char* keyToken = strtok_r(restValue, "=", &restValue);
             if (keyToken) {
-                RequestArgument arg;
+                RequestArgument& arg = _currentArgs[_currentArgCount++];
                 strncpy(arg.key, keyToken, SWS_MAX_ARG_KEY_LEN - 1);
                 arg.key[SWS_MAX_ARG_KEY_LEN - 1] = '\0';
                 if (restValue) {
@@ -555,7 +1139,6 @@ private:
                 else {
                     arg.value[0] = '\0';
                 }
-                _currentArgs.push_back(arg);
             #ifdef SWS_ENABLE_DEBUG_PRINTING
                 Serial.print(F("SWS_DEBUG_PARSE_ARGS: Arg: key=[")); Serial.print(arg.key);
                 Serial.print(F("], val=[")); Serial.print(arg.value); Serial.println(F("]"));
@@ -0,0 +1,55 @@
+// SERVER-SENT EVENT CLIENTS
+//
+// Holds connections taken over from a request handler and broadcasts event
+// frames to them. For servers without built-in event streams (ESP32 WebServer);
+// SimpleWebServer manages its own streams.
+
+#ifndef SSECLIENTS_H
+#define SSECLIENTS_H
+#include <Arduino.h>
+
+template <typename ClientT, int N>
+class SseClients {
+public:
+    // Sends the event-stream response headers and keeps the connection.
+    bool add(ClientT client) {
+        for (int i = 0; i < N; i++) {
+            if (!this->clients[i] || !this->clients[i].connected()) {
+                this->clients[i].stop();
+                this->clients[i] = client;
+                client.print(F("HTTP/1.1 200 OK\r\n"
+                    "Content-Type: text/event-stream\r\n"
+                    "Cache-Control: no-cache\r\n"
+                    "Connection: keep-alive\r\n\r\n"));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void broadcast(const char* frame) {
+        size_t len = strlen(frame);
+        for (int i = 0; i < N; i++) {
+            if (!this->clients[i]) {
+                continue;
+            }
+            if (!this->clients[i].connected() || this->clients[i].write((const uint8_t*)frame, len) != len) {
+                this->clients[i].stop();
+                this->clients[i] = ClientT();
+            }
+        }
+    }
+
+    int count() {
+        int n = 0;
+        for (int i = 0; i < N; i++) {
+            if (this->clients[i]) n++;
+        }
+        return n;
+    }
+
+private:
+    ClientT clients[N];
+};
+
+#endif
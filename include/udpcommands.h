@@ -0,0 +1,193 @@
+// UDP COMMAND CHANNEL
+//
+// Pad commands as single datagrams, for when a TCP connection and an HTTP
+// request are a lot of machinery for "abort":
+//
+//   Command: ['L'][command][seq u16][arg1][arg2][crc u16]                         8 bytes
+//   Ack:     ['l'][command][seq u16][status][clamp1][clamp2][flags][crc u16]      10 bytes
+//
+// Little-endian; crc is CRC-16/CCITT-FALSE over the bytes before it. Commands,
+// args and ack fields are those of the WebSocket frames (padcommands.h), and
+// they run through the same CommandCore as the HTTP routes.
+//
+// Datagrams get lost, so a client sends each command more than once and
+// repeats it until the ack arrives; every copy carries the same seq. The pad
+// runs a seq once per sender and answers the copies from the ack it kept,
+// so a repeated launch or nudge is never run twice. The exception is a BUSY
+// ack: the control link guarantees that command was not run and never will
+// be (controllink.h), so the next copy gets another try. Seqs just behind the
+// sender's last one are late copies and are dropped. A sender that has been
+// quiet for UDP_SENDER_EXPIRE_MS starts afresh; clients should pick a
+// random first seq.
+//
+// The time from a datagram being read to its ack being sent is kept as
+// "udp.command", comparable with the HTTP routes' route.<command> lines.
+
+#ifndef UDPCOMMANDS_H
+#define UDPCOMMANDS_H
+#include <Arduino.h>
+#include <stdio.h>
+#include "commandcore.h"
+#include "loopstats.h"
+#include "padcommands.h"
+
+#ifndef PAD_UDP_PORT
+#define PAD_UDP_PORT 4210               // 0 leaves the listener off
+#endif
+#define UDP_COMMAND_MAGIC 'L'
+#define UDP_ACK_MAGIC 'l'
+#define UDP_COMMAND_SIZE 8
+#define UDP_ACK_SIZE 10
+#define UDP_COMMAND_SENDERS 4           // Senders remembered for duplicate suppression
+#define UDP_SENDER_EXPIRE_MS 10000
+#define UDP_STALE_WINDOW 256            // Seqs this far behind the last are late copies
+#define UDP_MAX_PER_POLL 4              // Datagrams handled per poll()
+
+inline uint16_t udpCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+template <typename UDP>
+class UdpCommandServer {
+public:
+    uint32_t received = 0;      // Commands run
+    uint32_t repeats = 0;       // Copies answered from a kept ack
+    uint32_t stale = 0;         // Late copies dropped
+    uint32_t bad = 0;           // Wrong size, magic or checksum
+    CycleHistogram latency;     // Read -> ack sent, commands run
+
+    void begin(uint16_t port = PAD_UDP_PORT) {
+        if (port) {
+            this->started = this->udp.begin(port);
+        }
+    }
+
+    // Call from the network loop.
+    void poll(CommandCore& commands) {
+        if (!this->started) {
+            return;
+        }
+        for (int n = 0; n < UDP_MAX_PER_POLL; n++) {
+            int size = this->udp.parsePacket();
+            if (size <= 0) {
+                return;
+            }
+            uint32_t receivedMicros = micros();
+            uint8_t data[UDP_COMMAND_SIZE];
+            if (size != UDP_COMMAND_SIZE || this->udp.read(data, sizeof(data)) != UDP_COMMAND_SIZE ||
+                data[0] != UDP_COMMAND_MAGIC || udpCrc16(data, 6) != (uint16_t)(data[6] | data[7] << 8)) {
+                this->bad++;
+                continue;
+            }
+            handle(commands, data, receivedMicros);
+        }
+    }
+
+    void resetStats() {
+        this->latency.reset();
+    }
+
+    // "udp port=.. received=.. repeats=.. stale=.. bad=.." and, once a
+    // command has run, the udp.command histogram
+    size_t format(char* buffer, size_t size) const {
+        int len = snprintf(buffer, size, "udp port=%d received=%lu repeats=%lu stale=%lu bad=%lu\n",
+            this->started ? PAD_UDP_PORT : 0, (unsigned long)this->received, (unsigned long)this->repeats,
+            (unsigned long)this->stale, (unsigned long)this->bad);
+        if (len < 0) return 0;
+        if ((size_t)len >= size) return size - 1;
+        if (this->latency.count > 0) {
+            int more = this->latency.format(buffer + len, size - len, "udp.command");
+            if (more > 0) len += (size_t)more < size - len ? more : size - len - 1;
+        }
+        return len;
+    }
+
+private:
+    struct Sender {
+        uint32_t ip;
+        uint16_t port;
+        uint16_t seq;
+        unsigned long lastMillis;
+        PadAckFrame ack;
+        bool used;
+    };
+
+    UDP udp;
+    bool started = false;
+    Sender senders[UDP_COMMAND_SENDERS] = {};
+
+    void handle(CommandCore& commands, const uint8_t* data, uint32_t receivedMicros) {
+        IPAddress remote = this->udp.remoteIP();
+        uint32_t ip = (uint32_t)remote[0] << 24 | (uint32_t)remote[1] << 16 | (uint32_t)remote[2] << 8 | remote[3];
+        uint16_t port = this->udp.remotePort();
+        uint16_t seq = data[2] | data[3] << 8;
+        Sender& sender = find(ip, port);
+        if (sender.used && millis() - sender.lastMillis < UDP_SENDER_EXPIRE_MS) {
+            uint16_t behind = sender.seq - seq;
+            bool same = behind == 0 && sender.ack.command == data[1];
+            if (same && sender.ack.status != CMD_STATUS_BUSY) {
+                this->repeats++;
+                sender.lastMillis = millis();
+                reply(sender.ack, seq);
+                return;
+            }
+            if (!same && behind < UDP_STALE_WINDOW) {
+                this->stale++;
+                return;
+            }
+        }
+        PadCommandFrame cmd = { data[1], (uint8_t)seq, (int8_t)data[4], (int8_t)data[5] };
+        PadAckFrame ack;
+        commands.call(cmd, ack, receivedMicros);
+        this->received++;
+        sender = Sender{ ip, port, seq, millis(), ack, true };
+        reply(ack, seq);
+        this->latency.record(micros() - receivedMicros);
+    }
+
+    // The sender's slot, or the one to reuse for it (free or least recent)
+    Sender& find(uint32_t ip, uint16_t port) {
+        Sender* oldest = &this->senders[0];
+        for (int i = 0; i < UDP_COMMAND_SENDERS; i++) {
+            Sender& sender = this->senders[i];
+            if (sender.used && sender.ip == ip && sender.port == port) {
+                return sender;
+            }
+            if (!sender.used) {
+                oldest = &sender;
+            }
+            else if (oldest->used && (long)(sender.lastMillis - oldest->lastMillis) < 0) {
+                oldest = &sender;
+            }
+        }
+        oldest->used = false;
+        return *oldest;
+    }
+
+    void reply(const PadAckFrame& ack, uint16_t seq) {
+        uint8_t out[UDP_ACK_SIZE];
+        out[0] = UDP_ACK_MAGIC;
+        out[1] = ack.command;
+        out[2] = seq & 0xFF;
+        out[3] = seq >> 8;
+        out[4] = ack.status;
+        out[5] = ack.clamp1;
+        out[6] = ack.clamp2;
+        out[7] = ack.flags;
+        uint16_t crc = udpCrc16(out, 8);
+        out[8] = crc & 0xFF;
+        out[9] = crc >> 8;
+        this->udp.beginPacket(this->udp.remoteIP(), this->udp.remotePort());
+        this->udp.write(out, sizeof(out));
+        this->udp.endPacket();
+    }
+};
+
+#endif
@@ -0,0 +1,229 @@
+// WEBSOCKET CODEC
+//
+// Just enough of RFC 6455 for a small binary control channel: the opening
+// handshake key, an incremental parser for (masked) client frames and an
+// encoder for (unmasked) server frames. Messages must fit in one frame of at
+// most WS_MAX_PAYLOAD bytes; anything larger or fragmented is rejected.
+
+#ifndef WEBSOCKET_H
+#define WEBSOCKET_H
+#include <Arduino.h>
+#include <string.h>
+
+#define WS_MAX_PAYLOAD 32           // Largest client message accepted
+#define WS_KEY_LENGTH 32            // Buffer for the client's Sec-WebSocket-Key
+#define WS_ACCEPT_LENGTH 29         // Base64 SHA-1 (28 chars) + terminator
+#define WS_MAX_FRAME_HEADER 4       // Server frames are unmasked and at most 16-bit length
+
+enum WsOpcode {
+    WS_OP_CONTINUATION = 0x0,
+    WS_OP_TEXT = 0x1,
+    WS_OP_BINARY = 0x2,
+    WS_OP_CLOSE = 0x8,
+    WS_OP_PING = 0x9,
+    WS_OP_PONG = 0xA
+};
+
+// --- Handshake ---
+
+// SHA-1 of a short message (the handshake key plus GUID is 60 bytes).
+inline void wsSha1(const uint8_t* data, size_t len, uint8_t digest[20]) {
+    uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+    uint64_t bitLen = (uint64_t)len * 8;
+    size_t total = ((len + 8) / 64 + 1) * 64;
+
+    for (size_t chunk = 0; chunk < total; chunk += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++) {
+            uint32_t word = 0;
+            for (int j = 0; j < 4; j++) {
+                size_t idx = chunk + i * 4 + j;
+                uint8_t b;
+                if (idx < len) b = data[idx];
+                else if (idx == len) b = 0x80;
+                else if (idx >= total - 8) b = (uint8_t)(bitLen >> (8 * (total - 1 - idx)));
+                else b = 0;
+                word = (word << 8) | b;
+            }
+            w[i] = word;
+        }
+        for (int i = 16; i < 80; i++) {
+            uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+            w[i] = (x << 1) | (x >> 31);
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++) {
+            uint32_t f, k;
+            if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+            else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+            else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+            else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+            uint32_t temp = ((a << 5) | (a >> 27)) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = (b << 30) | (b >> 2);
+            b = a;
+            a = temp;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+    }
+    for (int i = 0; i < 20; i++) {
+        digest[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4)));
+    }
+}
+
+// Sec-WebSocket-Accept value for a client key: base64(SHA-1(key + GUID)).
+inline void wsAcceptKey(const char* clientKey, char accept[WS_ACCEPT_LENGTH]) {
+    static const char GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    static const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint8_t input[WS_KEY_LENGTH + sizeof(GUID)];
+    size_t keyLen = strnlen(clientKey, WS_KEY_LENGTH - 1);
+    memcpy(input, clientKey, keyLen);
+    memcpy(input + keyLen, GUID, sizeof(GUID) - 1);
+    uint8_t digest[21] = { 0 }; // One pad byte so the last base64 group can be read whole
+    wsSha1(input, keyLen + sizeof(GUID) - 1, digest);
+
+    int out = 0;
+    for (int i = 0; i < 20; i += 3) {
+        uint32_t group = ((uint32_t)digest[i] << 16) | ((uint32_t)digest[i + 1] << 8) | digest[i + 2];
+        accept[out++] = BASE64[(group >> 18) & 0x3F];
+        accept[out++] = BASE64[(group >> 12) & 0x3F];
+        accept[out++] = BASE64[(group >> 6) & 0x3F];
+        accept[out++] = BASE64[group & 0x3F];
+    }
+    accept[27] = '='; // 20 bytes leave one byte of padding
+    accept[28] = '\0';
+}
+
+// Writes the 101 Switching Protocols response into `buffer`; returns its length.
+inline int wsHandshakeResponse(const char* clientKey, char* buffer, size_t size) {
+    char accept[WS_ACCEPT_LENGTH];
+    wsAcceptKey(clientKey, accept);
+    return snprintf(buffer, size,
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+}
+
+// --- Frames ---
+
+// Encodes one unmasked server frame into `out` (WS_MAX_FRAME_HEADER + len bytes).
+inline size_t wsEncodeFrame(uint8_t opcode, const uint8_t* payload, size_t len, uint8_t* out) {
+    size_t n = 0;
+    out[n++] = 0x80 | opcode; // FIN
+    if (len < 126) {
+        out[n++] = (uint8_t)len;
+    }
+    else {
+        out[n++] = 126;
+        out[n++] = (uint8_t)(len >> 8);
+        out[n++] = (uint8_t)len;
+    }
+    if (len > 0) {
+        memcpy(out + n, payload, len);
+    }
+    return n + len;
+}
+
+class WsFrameParser {
+public:
+    enum Result {
+        WS_NEED_MORE,
+        WS_MESSAGE,     // opcode()/payload()/length() describe a complete frame
+        WS_ERROR        // Protocol violation or oversized frame; close the connection
+    };
+
+    void reset() {
+        this->state = HEADER0;
+    }
+
+    Result feed(uint8_t b) {
+        switch (this->state) {
+            case HEADER0:
+                // Fragmented messages and reserved bits are not supported
+                if ((b & 0x80) == 0 || (b & 0x70) != 0 || (b & 0x0F) == WS_OP_CONTINUATION) {
+                    return WS_ERROR;
+                }
+                this->op = b & 0x0F;
+                this->state = HEADER1;
+                return WS_NEED_MORE;
+
+            case HEADER1:
+                if ((b & 0x80) == 0) {
+                    return WS_ERROR; // Client frames must be masked
+                }
+                this->len = b & 0x7F;
+                if (this->len == 126) {
+                    this->len = 0;
+                    this->lenBytes = 2;
+                    this->state = EXT_LENGTH;
+                }
+                else if (this->len == 127) {
+                    return WS_ERROR;
+                }
+                else {
+                    this->pos = 0;
+                    this->state = MASK;
+                }
+                return WS_NEED_MORE;
+
+            case EXT_LENGTH:
+                this->len = (this->len << 8) | b;
+                if (--this->lenBytes == 0) {
+                    this->pos = 0;
+                    this->state = MASK;
+                }
+                return WS_NEED_MORE;
+
+            case MASK:
+                this->mask[this->pos++] = b;
+                if (this->pos < 4) {
+                    return WS_NEED_MORE;
+                }
+                if (this->len > WS_MAX_PAYLOAD) {
+                    return WS_ERROR;
+                }
+                this->pos = 0;
+                if (this->len == 0) {
+                    this->state = HEADER0;
+                    return WS_MESSAGE;
+                }
+                this->state = PAYLOAD;
+                return WS_NEED_MORE;
+
+            case PAYLOAD:
+                this->payloadBuf[this->pos] = b ^ this->mask[this->pos & 3];
+                if (++this->pos < this->len) {
+                    return WS_NEED_MORE;
+                }
+                this->state = HEADER0;
+                return WS_MESSAGE;
+        }
+        return WS_ERROR;
+    }
+
+    uint8_t opcode() const {
+        return this->op;
+    }
+
+    const uint8_t* payload() const {
+        return this->payloadBuf;
+    }
+
+    size_t length() const {
+        return this->len;
+    }
+
+private:
+    enum State { HEADER0, HEADER1, EXT_LENGTH, MASK, PAYLOAD };
+    State state = HEADER0;
+    uint8_t op = 0;
+    uint8_t mask[4];
+    uint8_t lenBytes = 0;
+    size_t len = 0;
+    size_t pos = 0;
+    uint8_t payloadBuf[WS_MAX_PAYLOAD];
+};
+
+#endif
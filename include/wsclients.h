@@ -0,0 +1,117 @@
+// WEBSOCKET CLIENTS
+//
+// Holds connections upgraded from a request handler and parses their frames.
+// For servers without built-in WebSockets (ESP32 WebServer); SimpleWebServer
+// manages its own.
+
+#ifndef WSCLIENTS_H
+#define WSCLIENTS_H
+#include <Arduino.h>
+#include <websocket.h>
+
+#define WS_CLIENTS_READ_CHUNK 64
+
+template <typename ClientT, int N>
+class WsClients {
+public:
+    typedef void (*MessageHandler)(const uint8_t* data, size_t len);
+
+    // Answers the handshake for `key` and keeps the connection.
+    bool add(ClientT client, const char* key) {
+        for (int i = 0; i < N; i++) {
+            if (!this->clients[i] || !this->clients[i].connected()) {
+                this->clients[i].stop();
+                this->clients[i] = client;
+                this->parsers[i].reset();
+                char response[160];
+                int len = wsHandshakeResponse(key, response, sizeof(response));
+                client.write((const uint8_t*)response, len);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads whatever has arrived and passes each text or binary message to
+    // `handler`, which may answer with reply(). Call every loop iteration.
+    void poll(MessageHandler handler) {
+        for (int i = 0; i < N; i++) {
+            if (!this->clients[i]) {
+                continue;
+            }
+            if (!this->clients[i].connected()) {
+                close(i);
+                continue;
+            }
+            uint8_t rx[WS_CLIENTS_READ_CHUNK];
+            int available = this->clients[i].available();
+            int n = available > 0 ? this->clients[i].read(rx, min(available, (int)sizeof(rx))) : 0;
+            for (int j = 0; j < n && this->clients[i]; j++) {
+                WsFrameParser::Result result = this->parsers[i].feed(rx[j]);
+                if (result == WsFrameParser::WS_ERROR) {
+                    close(i);
+                }
+                else if (result == WsFrameParser::WS_MESSAGE) {
+                    handleFrame(i, handler);
+                }
+            }
+        }
+    }
+
+    // Sends a binary message to the client whose message is being handled.
+    void reply(const uint8_t* data, size_t len) {
+        if (this->current >= 0) {
+            send(this->current, WS_OP_BINARY, data, len);
+        }
+    }
+
+    int count() {
+        int n = 0;
+        for (int i = 0; i < N; i++) {
+            if (this->clients[i]) n++;
+        }
+        return n;
+    }
+
+private:
+    ClientT clients[N];
+    WsFrameParser parsers[N];
+    int current = -1;
+
+    void handleFrame(int i, MessageHandler handler) {
+        const WsFrameParser& ws = this->parsers[i];
+        switch (ws.opcode()) {
+            case WS_OP_TEXT:
+            case WS_OP_BINARY:
+                this->current = i;
+                handler(ws.payload(), ws.length());
+                this->current = -1;
+                break;
+            case WS_OP_PING:
+                send(i, WS_OP_PONG, ws.payload(), ws.length());
+                break;
+            case WS_OP_CLOSE:
+                send(i, WS_OP_CLOSE, ws.payload(), min(ws.length(), (size_t)2));
+                close(i);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // One write() per frame
+    void send(int i, uint8_t opcode, const uint8_t* data, size_t len) {
+        uint8_t frame[WS_MAX_FRAME_HEADER + WS_MAX_PAYLOAD];
+        if (len > WS_MAX_PAYLOAD) {
+            return;
+        }
+        this->clients[i].write(frame, wsEncodeFrame(opcode, data, len, frame));
+    }
+
+    void close(int i) {
+        this->clients[i].stop();
+        this->clients[i] = ClientT();
+    }
+};
+
+#endif
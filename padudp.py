@@ -0,0 +1,165 @@
+# UDP command client (see include/udpcommands.h), and a benchmark of an
+# abort over UDP against the /abort GET.
+#
+#   python padudp.py 192.168.4.1 abort
+#   python padudp.py 192.168.4.1 nudge 1 -1
+#   python padudp.py localhost --port 12210 --http localhost:8080 --bench 500
+#
+# Each command goes out `--copies` times back to back and is repeated every
+# `--retry-ms` until its ack arrives; the pad runs it once.
+
+import argparse
+import http.client
+import random
+import socket
+import statistics
+import struct
+import time
+
+COMMANDS = ["ping", "launch", "abort", "clamps_open", "clamps_close", "clamps_nudge",
+            "hold", "recycle", "arm", "disarm"]
+ALIASES = {"open": "clamps_open", "close": "clamps_close", "nudge": "clamps_nudge"}
+STATUS = ["ok", "bad frame", "unknown command", "rejected", "busy", "no continuity"]
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+class PadUdp:
+    def __init__(self, host, port, copies=2, retry_ms=20, timeout_ms=500):
+        self.address = (host, port)
+        self.copies = copies
+        self.retry = retry_ms / 1000
+        self.timeout = timeout_ms / 1000
+        self.seq = random.randrange(0x10000)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    def send(self, command, arg1=0, arg2=0):
+        """Runs a command; returns (status, clamp1, clamp2, flags) or None on timeout."""
+        self.seq = (self.seq + 1) & 0xFFFF
+        body = struct.pack("<cBHbb", b"L", COMMANDS.index(command), self.seq, arg1, arg2)
+        datagram = body + struct.pack("<H", crc16(body))
+        start = time.perf_counter()
+        copies = self.copies
+        while time.perf_counter() - start < self.timeout:
+            for _ in range(copies):
+                self.sock.sendto(datagram, self.address)
+            copies = 1
+            ack = self._wait_ack(min(self.retry, self.timeout - (time.perf_counter() - start)))
+            if ack:
+                return ack
+        return None
+
+    def _wait_ack(self, wait):
+        deadline = time.perf_counter() + wait
+        while (remaining := deadline - time.perf_counter()) > 0:
+            self.sock.settimeout(remaining)
+            try:
+                data = self.sock.recv(64)
+            except socket.timeout:
+                return None
+            if len(data) != 10 or data[0:1] != b"l" or crc16(data[:8]) != struct.unpack("<H", data[8:])[0]:
+                continue
+            _, _, seq, status, clamp1, clamp2, flags = struct.unpack("<cBHBBBB", data[:8])
+            if seq == self.seq:
+                return status, clamp1, clamp2, flags
+        return None
+
+
+def summary(name, times):
+    times = sorted(t * 1000 for t in times)
+    p99 = times[min(len(times) - 1, round(0.99 * len(times)) - 1)]
+    print(f"{name:<26}{len(times):>7}{statistics.median(times):>9.3f}{p99:>9.3f}"
+          f"{statistics.mean(times):>9.3f}{times[-1]:>9.3f}")
+
+
+def bench(pad, http_host, count):
+    conn = http.client.HTTPConnection(http_host, timeout=5)
+    conn.request("GET", "/sequence")
+    state = conn.getresponse().read().decode()
+    if "phase=SAFE" not in state:
+        raise SystemExit(f"Pad is not SAFE ({state.strip()}); refusing to benchmark")
+    conn.request("GET", "/metrics?reset=1")
+    conn.getresponse().read()
+
+    udp, lost = [], 0
+    for _ in range(count):
+        start = time.perf_counter()
+        if pad.send("abort") is None:
+            lost += 1
+            continue
+        udp.append(time.perf_counter() - start)
+
+    keepalive = []
+    for _ in range(count):
+        start = time.perf_counter()
+        conn.request("GET", "/abort")
+        conn.getresponse().read()
+        keepalive.append(time.perf_counter() - start)
+    conn.close()
+
+    fresh = []
+    for _ in range(count):
+        start = time.perf_counter()
+        conn = http.client.HTTPConnection(http_host, timeout=5)
+        conn.request("GET", "/abort")
+        conn.getresponse().read()
+        conn.close()
+        fresh.append(time.perf_counter() - start)
+
+    print(f"{'abort, round trip':<26}{'count':>7}{'p50 ms':>9}{'p99 ms':>9}{'mean ms':>9}{'max ms':>9}")
+    summary(f"UDP ({pad.copies} copies)", udp)
+    summary("HTTP GET, keep-alive", keepalive)
+    summary("HTTP GET, new connection", fresh)
+    if lost:
+        print(f"{lost} UDP aborts got no ack")
+
+    # The pad's own view, without the wait for its next network poll
+    conn = http.client.HTTPConnection(http_host, timeout=5)
+    conn.request("GET", "/metrics")
+    metrics = conn.getresponse().read().decode()
+    conn.close()
+    print("\nOn the pad, read to reply sent (us):")
+    for line in metrics.splitlines():
+        if line.startswith(("udp.command", "route.abort")):
+            print("  " + line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Send pad commands over UDP")
+    parser.add_argument("host")
+    parser.add_argument("command", nargs="?", default="ping", help=", ".join(COMMANDS))
+    parser.add_argument("args", nargs="*", type=int, help="nudge: clamp1 clamp2 steps, -1, 0 or 1")
+    parser.add_argument("--port", type=int, default=4210)
+    parser.add_argument("--copies", type=int, default=2, help="copies sent at once")
+    parser.add_argument("--retry-ms", type=float, default=20)
+    parser.add_argument("--timeout-ms", type=float, default=500)
+    parser.add_argument("--bench", type=int, metavar="N", help="time N aborts over UDP and over HTTP")
+    parser.add_argument("--http", help="host:port of the web server for --bench (default: host)")
+    args = parser.parse_intermixed_args()
+
+    pad = PadUdp(args.host, args.port, args.copies, args.retry_ms, args.timeout_ms)
+    if args.bench:
+        bench(pad, args.http or args.host, args.bench)
+        return
+
+    command = ALIASES.get(args.command, args.command)
+    if command not in COMMANDS:
+        raise SystemExit(f"Unknown command {args.command}")
+    ack = pad.send(command, *args.args[:2])
+    if ack is None:
+        raise SystemExit("No ack")
+    status, clamp1, clamp2, flags = ack
+    print(f"{STATUS[status] if status < len(STATUS) else status}: clamps ({clamp1}, {clamp2}), "
+          f"armed={flags & 1} firing={flags >> 1 & 1}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,38 +1,364 @@
 #include <Arduino.h>
 #include <WiFi.h>
+#include <WiFiUdp.h>
 #include <WebServer.h>
 #include <clamps.h>
-#include <pyro.h>
+#include <pyrobank.h>
 #include <leds.h>
 #include <buzzer.h>
 #include <html.h>
+#include <loopstats.h>
+#include <padstate.h>
+#include <sseclients.h>
+#include <wsclients.h>
+#include <padcommands.h>
+#include <launchsequence.h>
+#include <calibration.h>
+#include <controllink.h>
+#include <commandcore.h>
+#include <udpcommands.h>
+#include <eventlog.h>
+#include <padsensors.h>
+
+// The control loop (sequence, clamps, pyros, buzzer, LEDs) runs in its own
+// task on core 1, ticking every CONTROL_TICK_MS; Wi-Fi and the web server stay
+// on core 0. Handlers hand commands and settings over through `controlLink`
+// and the control task publishes a PadState snapshot back, so HTTP load
+// cannot delay the pad. Only the network task prints.
+#define CONTROL_CORE 1
+#define NETWORK_CORE 0
+#define CONTROL_TICK_MS 1
+#define CONTROL_TASK_PRIORITY (configMAX_PRIORITIES - 2)
+#define NETWORK_TASK_PRIORITY 1
+#define TASK_STACK_SIZE 8192
+
+void controlTask(void* arg);
+void networkTask(void* arg);
 
 Clamps clamps = Clamps();
-PyroChannel igniter = PyroChannel(13, 2000);
+// Pyro schedule: { pin, delay ms, duration ms } per channel, from ignition.
+// Channels with the same delay switch together in one GPIO write; add
+// clustered or staged motors here.
+const PyroStep PYRO_SCHEDULE[] = {
+    { PYRO_IGNITION_PIN, 0, 2000 },  // Main motor igniter
+};
+PyroBank<sizeof(PYRO_SCHEDULE) / sizeof(PYRO_SCHEDULE[0])> pyros(PYRO_SCHEDULE);
+CalibrationStore calibrationStore;
+PadSensors sensors;
+LoopStats controlStats;     // Core 1
+LoopStats networkStats;     // Core 0
+PadStateEvents padEvents;
+SseClients<WiFiClient, 3> eventClients;
+WsClients<WiFiClient, 2> wsClients;
 
 const char* ssid = "LaunchPad";      // or whatever WiFi you want to create
 const char* password = "12345678";    // min 8 characters for softAP
 
 WebServer server(80);
 
-// ... (launch, abortLaunch, and other functions remain the same) ...
+// Lets the control task run while a handler waits for its ack
+void waitForControl() {
+    vTaskDelay(1);
+}
+
+ControlLink controlLink(waitForControl);
+
+// Launch sequence steps
+void ignite() {
+    pyros.fire();
+    playIgnitionSound();
+}
 
-void launch() {
+void releaseClamps() {
     clamps.openClamps();
-    igniter.fire();
 }
 
-void abortLaunch() {
+void makeSafe() {
+    pyros.stop();
     clamps.closeClamps();
-    igniter.stop();
 }
 
+bool clampsMoving() {
+    return clamps.isMoving();
+}
+
+// Pyros only arm, and the countdown only runs, with a valid continuity
+// reading
+bool igniterConnected() {
+    return sensors.hasContinuity();
+}
+
+LaunchSequence sequence({ ignite, releaseClamps, makeSafe, playCountdownTick, clampsMoving, igniterConnected });
+
+// Starts the countdown from ARMED, or resumes it from HOLD, with the
+// igniter in circuit
+uint8_t launch() {
+    if (sequence.start()) {
+        return CMD_STATUS_OK;
+    }
+    LaunchPhase phase = sequence.getPhase();
+    return phase == PHASE_ARMED || phase == PHASE_HOLD ? CMD_STATUS_NO_CONTINUITY : CMD_STATUS_REJECTED;
+}
+
+void abortLaunch() {
+    sequence.abort();
+    playAbortSound();
+}
+
+// Back to ARMED for another attempt. The pyros are re-armed through the
+// continuity check, since the last igniter has usually burnt; without one
+// the pad is left SAFE and disarmed.
+uint8_t recycle() {
+    if (!sequence.recycle()) {
+        return CMD_STATUS_REJECTED;
+    }
+    if (!pyros.arm()) {
+        pyros.disarm();
+        sequence.disarm();
+        return CMD_STATUS_NO_CONTINUITY;
+    }
+    return CMD_STATUS_OK;
+}
+
+// Snapshot of everything the UI displays; built on the control core and
+// pushed on /events from the network core
+PadState readPadState() {
+    PadState state;
+    state.armed = pyros.getArmed();
+    state.firing = pyros.getFiring();
+    Vec2D pos = clamps.getPos();
+    state.clamp1 = pos.x;
+    state.clamp2 = pos.y;
+    state.loopMaxMs = controlStats.iteration.maxUs / 1000;
+    state.overruns = controlStats.iteration.overruns;
+    state.phase = sequence.getPhase();
+    state.clockMs = sequence.getClock();
+    state.continuity = sensors.hasContinuity();
+    state.padMv = sensors.padMv();
+    return state;
+}
+
+// Runs one command on the control core and builds its ack
+PadAckFrame executePadCommand(const PadCommandFrame& cmd) {
+    PadAckFrame ack = { cmd.command, cmd.seq, CMD_STATUS_OK, 0, 0, 0 };
+    switch (cmd.command) {
+        case CMD_PING:
+            break;
+        case CMD_LAUNCH:
+            ack.status = launch();
+            break;
+        case CMD_ABORT:
+            abortLaunch();
+            break;
+        case CMD_CLAMPS_OPEN:
+            clamps.openClamps();
+            break;
+        case CMD_CLAMPS_CLOSE:
+            clamps.closeClamps();
+            break;
+        case CMD_CLAMPS_NUDGE:
+            clamps.nudge(cmd.arg1, cmd.arg2);
+            break;
+        case CMD_HOLD:
+            ack.status = sequence.hold() ? CMD_STATUS_OK : CMD_STATUS_REJECTED;
+            break;
+        case CMD_RECYCLE:
+            ack.status = recycle();
+            break;
+        case CMD_ARM:
+            // Only while idle, and only with the igniter in circuit
+            if (sequence.getPhase() != PHASE_SAFE && sequence.getPhase() != PHASE_ARMED) {
+                ack.status = CMD_STATUS_REJECTED;
+            }
+            else if (!pyros.arm()) {
+                ack.status = CMD_STATUS_NO_CONTINUITY;
+            }
+            else {
+                sequence.arm();
+            }
+            break;
+        case CMD_DISARM:
+            // After an abort or a launch, via ARMED; a running sequence needs an abort first
+            if (sequence.getPhase() == PHASE_ABORT || sequence.getPhase() == PHASE_COMPLETE) {
+                sequence.recycle();
+            }
+            if (sequence.getPhase() != PHASE_SAFE && !sequence.disarm()) {
+                ack.status = CMD_STATUS_REJECTED;
+            }
+            else {
+                pyros.disarm();
+            }
+            break;
+        default:
+            ack.status = CMD_STATUS_UNKNOWN_COMMAND;
+            break;
+    }
+    Vec2D pos = clamps.getPos();
+    ack.clamp1 = pos.x;
+    ack.clamp2 = pos.y;
+    ack.flags = (pyros.getArmed() ? PAD_FLAG_ARMED : 0) | (pyros.getFiring() ? PAD_FLAG_FIRING : 0);
+    return ack;
+}
+
+// --- Control core jobs (see ControlLink::run) ---
+
+// /sequence: applies the values given, then reports
+struct SequenceJob {
+    bool setCountdown;
+    bool setRelease;
+    long countdownMs;
+    long releaseMs;
+    const char* phase;
+};
+
+bool sequenceJob(SequenceJob& job) {
+    bool ok = true;
+    if (job.setCountdown || job.setRelease) {
+        ok = sequence.configure(job.setCountdown ? job.countdownMs : sequence.getCountdown(),
+            job.setRelease ? job.releaseMs : sequence.getClampRelease());
+    }
+    job.countdownMs = sequence.getCountdown();
+    job.releaseMs = sequence.getClampRelease();
+    job.phase = sequence.getPhaseName();
+    return ok;
+}
+
+enum CalibrationChange : uint8_t {
+    CALIBRATION_READ,
+    CALIBRATION_PRESET_OPEN,    // Current position becomes the open preset
+    CALIBRATION_PRESET_CLOSE,
+    CALIBRATION_LIMITS
+};
+
+const int16_t CLAMP_LIMIT_KEEP = INT16_MIN;
+
+// /clamps/preset, /clamps/limits, /clamps/calibration. Changes are refused
+// while the sequence runs; `cal` comes back as the clamps now have it.
+struct CalibrationJob {
+    CalibrationChange change;
+    int16_t limits[4];          // min1, max1, min2, max2; CLAMP_LIMIT_KEEP leaves one as it is
+    ClampCalibration cal;
+};
+
+bool calibrationJob(CalibrationJob& job) {
+    ClampCalibration cal = clamps.getCalibration();
+    if (job.change != CALIBRATION_READ) {
+        if (sequence.isRunning()) {
+            return false;
+        }
+        Vec2D pos = clamps.getPos();
+        int16_t* limits[4] = { &cal.clamp1Min, &cal.clamp1Max, &cal.clamp2Min, &cal.clamp2Max };
+        switch (job.change) {
+            case CALIBRATION_PRESET_OPEN:
+                cal.clamp1Open = pos.x;
+                cal.clamp2Open = pos.y;
+                break;
+            case CALIBRATION_PRESET_CLOSE:
+                cal.clamp1Close = pos.x;
+                cal.clamp2Close = pos.y;
+                break;
+            default:
+                for (int i = 0; i < 4; i++) {
+                    if (job.limits[i] != CLAMP_LIMIT_KEEP) *limits[i] = job.limits[i];
+                }
+                break;
+        }
+        clamps.setCalibration(cal);
+    }
+    job.cal = clamps.getCalibration();
+    return true;
+}
+
+// /metrics?reset=1: the control task's own stats
+bool resetControlStats(int&) {
+    controlStats.reset();
+    outputs.resetCounters();
+    return true;
+}
+
+// Command core transport: WebServer query args and replies
+bool queryArg(const char* name, char* value, size_t size) {
+    if (!server.hasArg(name)) {
+        return false;
+    }
+    snprintf(value, size, "%s", server.arg(name).c_str());
+    return true;
+}
+
+void sendReply(int code, const char* text) {
+    server.send(code, "text/plain", text);
+}
+
+CommandCore commands(controlLink, { queryArg, sendReply });
+UdpCommandServer<WiFiUDP> udpCommands;  // Datagram commands, see udpcommands.h
+
+void onWsMessage(const uint8_t* data, size_t len) {
+    PadCommandFrame cmd;
+    PadAckFrame ack = { 0, 0, CMD_STATUS_BAD_FRAME, 0, 0, 0 };
+    if (cmd.decode(data, len)) {
+        commands.call(cmd, ack);
+    }
+    uint8_t reply[PAD_ACK_FRAME_SIZE];
+    wsClients.reply(reply, ack.encode(reply));
+}
+
+// Replies 409 or 503 for a job the control core refused or did not run
+bool jobFailed(uint8_t status) {
+    if (status == CMD_STATUS_OK) {
+        return false;
+    }
+    server.send(status == CMD_STATUS_REJECTED ? 409 : 503, "text/plain",
+        status == CMD_STATUS_REJECTED ? "Sequence running" : "Control loop busy");
+    return true;
+}
+
+// Runs `job` on the control core and replies with the clamp calibration,
+// saving it first if the job changed it (flash is only written when it
+// differs from what is stored)
+void serveCalibration(CalibrationJob& job) {
+    if (jobFailed(controlLink.run<CalibrationJob, calibrationJob>(job))) {
+        return;
+    }
+    if (job.change != CALIBRATION_READ && !calibrationStore.save(job.cal)) {
+        server.send(500, "text/plain", "Calibration not saved");
+        return;
+    }
+    char response[CALIBRATION_FORMAT_SIZE];
+    calibrationStore.format(job.cal, response, sizeof(response));
+    server.send(200, "text/plain", response);
+}
+
+// Serial lines for what the control task did, from each new snapshot
+void announce(const PadState& state) {
+    static PadState last;
+    if (!state.firing && last.firing) {
+        Serial.print("Pyro burn complete, skew ");
+        Serial.print(pyros.getSkew());
+        Serial.print(" us, burn ");
+        Serial.print(pyros.getLastBurn(0));
+        Serial.println(" us");
+    }
+    if (state.phase == PHASE_ABORT && last.phase != state.phase && !state.continuity) {
+        Serial.println("ABORT: igniter continuity lost");
+    }
+    static uint32_t lastRefused = 0;
+    uint32_t refused = pyros.getRefused();
+    if (refused != lastRefused) {
+        Serial.println("ERROR: Pyro bank not armed!");
+        lastRefused = refused;
+    }
+    last = state;
+}
 
 void setup() {
     Serial.begin(115200);
-    digitalWrite(13, HIGH);
     Serial.println("Hello World!");
-    digitalWrite(13, LOW);
+
+    ClampCalibration calibration = clamps.getCalibration();
+    if (calibrationStore.begin(calibration)) {
+        clamps.setCalibration(calibration);
+        Serial.printf("Clamp calibration restored in %lu us\n", (unsigned long)calibrationStore.loadMicros);
+    }
 
     // Create Access Point
     WiFi.softAP(ssid, password);
@@ -40,82 +366,230 @@ void setup() {
     Serial.print("AP IP address: ");
     Serial.println(myIP);
 
-    // Serve the HTML UI
+    // Serve the HTML UI, gzipped. Browsers revalidate with If-None-Match
+    // and get an empty 304 while the page is unchanged.
     server.on("/", HTTP_GET, []() {
-        server.send(200, "text/html", index_html); // assume you have `index_html` defined somewhere
+        server.sendHeader("ETag", index_html_etag);
+        server.sendHeader("Cache-Control", "no-cache");
+        if (server.header("If-None-Match").indexOf(index_html_etag) >= 0) {
+            server.send(304);
+            return;
+        }
+        server.sendHeader("Content-Encoding", "gzip");
+        server.send_P(200, "text/html", (const char*)index_html_gz, index_html_gz_len);
         });
 
-    // Handle commands
-    server.on("/launch", HTTP_GET, []() {
-        Serial.println("Launch sequence initiated");
-        launch(); // Your function
-        server.send(200, "text/plain", "Launch triggered");
+    // Pad commands, served by the command core (see commandcore.h)
+    for (int i = 0; i < COMMAND_ROUTE_COUNT; i++) {
+        server.on(COMMAND_ROUTES[i].path, HTTP_GET, [i]() {
+            commands.serve(i);
+            });
+    }
+
+    // Countdown and clamp release offset (ms, relative to ignition),
+    // e.g. /sequence?countdown=10000&release=500. No args just reports.
+    server.on("/sequence", HTTP_GET, []() {
+        SequenceJob job = {};
+        job.setCountdown = server.hasArg("countdown");
+        job.setRelease = server.hasArg("release");
+        job.countdownMs = server.arg("countdown").toInt();
+        job.releaseMs = server.arg("release").toInt();
+        if (jobFailed(controlLink.run<SequenceJob, sequenceJob>(job))) {
+            return;
+        }
+        char response[96];
+        snprintf(response, sizeof(response), "phase=%s countdown=%ld release=%ld\n",
+            job.phase, job.countdownMs, job.releaseMs);
+        server.send(200, "text/plain", response);
         });
 
-    server.on("/abort", HTTP_GET, []() {
-        Serial.println("ABORT!");
-        abortLaunch(); // Your function
-        server.send(200, "text/plain", "Abort triggered");
+    // Store the current position as the open or close preset (?name=open|close)
+    server.on("/clamps/preset", HTTP_GET, []() {
+        CalibrationJob job = {};
+        String name = server.arg("name");
+        if (name == "open") {
+            job.change = CALIBRATION_PRESET_OPEN;
+        }
+        else if (name == "close") {
+            job.change = CALIBRATION_PRESET_CLOSE;
+        }
+        else {
+            server.send(400, "text/plain", "name must be open or close");
+            return;
+        }
+        serveCalibration(job);
         });
 
-    server.on("/clamps/open", HTTP_GET, []() {
-        Serial.println("Clamps OPEN");
-        clamps.openClamps(); // Your function
-        server.send(200, "text/plain", "Clamps opened");
+    // Soft travel limits in degrees (?min1=&max1=&min2=&max2=)
+    server.on("/clamps/limits", HTTP_GET, []() {
+        static const char* const names[4] = { "min1", "max1", "min2", "max2" };
+        CalibrationJob job = {};
+        job.change = CALIBRATION_LIMITS;
+        for (int i = 0; i < 4; i++) {
+            job.limits[i] = server.hasArg(names[i]) ? server.arg(names[i]).toInt() : CLAMP_LIMIT_KEEP;
+        }
+        serveCalibration(job);
         });
 
-    server.on("/clamps/close", HTTP_GET, []() {
-        Serial.println("Clamps CLOSED");
-        clamps.closeClamps(); // Your function
-        server.send(200, "text/plain", "Clamps closed");
+    server.on("/clamps/calibration", HTTP_GET, []() {
+        CalibrationJob job = {};
+        serveCalibration(job);
         });
 
-    // --- NEW: NUDGE HANDLERS ---
-    server.on("/clamps/nudge", HTTP_GET, []() {
-        int clamp1 = 0, clamp2 = 0;
+    // Server-Sent Event stream of pad state. WebServer lets go of the
+    // connection once the handler returns; eventClients keeps it open.
+    server.on("/events", HTTP_GET, []() {
+        if (!eventClients.add(server.client())) {
+            server.send(503, "text/plain", "Too many event streams");
+            return;
+        }
+        padEvents.invalidate(); // Send the current state straight away
+        });
 
-        if (server.hasArg("clamp1")) {
-            clamp1 = server.arg("clamp1").toInt();
+    // WebSocket control channel (binary frames, see padcommands.h). Like
+    // /events, the connection is taken over from WebServer by wsClients.
+    server.on("/ws", HTTP_GET, []() {
+        String key = server.header("Sec-WebSocket-Key");
+        if (key.length() == 0) {
+            server.send(400, "text/plain", "WebSocket upgrade required");
+            return;
         }
-        else {
-            clamp1 = 0;
+        if (!wsClients.add(server.client(), key.c_str())) {
+            server.send(503, "text/plain", "Too many WebSockets");
         }
-        if (server.hasArg("clamp2")) {
-            clamp2 = server.arg("clamp2").toInt();
+        });
+
+    // Event log, oldest first, as CSV or as 8-byte binary records
+    // (?format=bin); ?consume=1 leaves the sent records out of later dumps
+    server.on("/log", HTTP_GET, []() {
+        static char chunk[1024];
+        EventLogReader reader(eventLog);
+        bool binary = server.arg("format") == "bin";
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        server.send(200, binary ? "application/octet-stream" : "text/csv", "");
+        size_t len;
+        while ((len = binary ? reader.readBinary((uint8_t*)chunk, sizeof(chunk)) : reader.readCsv(chunk, sizeof(chunk))) > 0) {
+            server.sendContent(chunk, len);
         }
-        else {
-            clamp2 = 0;
+        server.sendContent(""); // Last chunk
+        if (server.hasArg("consume")) {
+            reader.consume();
         }
-        Serial.printf("Nudging Clamps: clamp1=%d, clamp2=%d\n", clamp1, clamp2);
-        clamps.nudge(clamp1, clamp2);
+        });
 
-        Vec2D pos = clamps.getPos();
-        String response = "Position: (" + String(pos.x) + ", " + String(pos.y) + ")";
-        server.send(200, "text/plain", response);
-        Serial.println(response);
+    // Loop and stage timing histograms per core (?reset=1 clears them)
+    server.on("/metrics", HTTP_GET, []() {
+        static char metrics[LOOPSTATS_FORMAT_BUFFER_SIZE];
+        size_t len = controlStats.format(metrics, sizeof(metrics), "control");
+        len += networkStats.format(metrics + len, sizeof(metrics) - len, "network");
+        snprintf(metrics + len, sizeof(metrics) - len,
+            "sequence phase=%s t=%ld ticks=%lu late_max_ms=%lu\n",
+            sequence.getPhaseName(), sequence.getClock(), sequence.getTicks(), sequence.getMaxLateness());
+        len += strlen(metrics + len);
+        len += controlLink.format(metrics + len, sizeof(metrics) - len);
+        len += commands.format(metrics + len, sizeof(metrics) - len);
+        snprintf(metrics + len, sizeof(metrics) - len, "eventlog core0=%lu core1=%lu size=%d\n",
+            (unsigned long)eventLog.count(0), (unsigned long)eventLog.count(1), EVENT_LOG_SIZE);
+        len += strlen(metrics + len);
+        len += pyros.format(metrics + len, sizeof(metrics) - len, "bank");
+        len += sensors.format(metrics + len, sizeof(metrics) - len);
+        len += leds.format(metrics + len, sizeof(metrics) - len);
+        len += udpCommands.format(metrics + len, sizeof(metrics) - len);
+        outputs.format(metrics + len, sizeof(metrics) - len);
+        if (server.hasArg("reset")) {
+            int none = 0;
+            controlLink.run<int, resetControlStats>(none);
+            controlLink.resetStats();
+            commands.resetStats();
+            udpCommands.resetStats();
+            networkStats.reset();
+            outputs.resetCounters(); // This core's writes; the job cleared the other's
+        }
+        server.send(200, "text/plain", metrics);
         });
 
+    const char* headerKeys[] = { "If-None-Match", "Sec-WebSocket-Key" };
+    server.collectHeaders(headerKeys, 2);
     server.begin();
+    udpCommands.begin();
     Serial.println("Web server started");
 
-    igniter.begin();
-    igniter.arm();
+    pyros.begin();
+    pyros.setArmCheck(igniterConnected);
+    if (pyros.unmaskedPin() >= 0) {
+        Serial.print("WARNING: Pyro pin not mask-writable, using digitalWrite: ");
+        Serial.println(pyros.unmaskedPin());
+    }
+    sensors.begin();
+    // Stays SAFE until /arm: arming needs a settled continuity reading
 
-    pinMode(LED_BUILTIN, OUTPUT);
-    digitalWrite(LED_BUILTIN, LOW);
+    pinMode(STATUS_LED_PIN, OUTPUT);
+    digitalWrite(STATUS_LED_PIN, LOW);
     pinMode(BUZZER_PIN, OUTPUT);
     pinMode(LEDR, OUTPUT);
     pinMode(LEDG, OUTPUT);
     pinMode(LEDB, OUTPUT);
+
+    playStartupSound();
+
+    controlLink.publish(readPadState());
+    xTaskCreatePinnedToCore(controlTask, "control", TASK_STACK_SIZE, NULL, CONTROL_TASK_PRIORITY, NULL, CONTROL_CORE);
+    xTaskCreatePinnedToCore(networkTask, "network", TASK_STACK_SIZE, NULL, NETWORK_TASK_PRIORITY, NULL, NETWORK_CORE);
 }
 
-void loop() {
-    server.handleClient();
+// Core 1: everything that touches the pad, on a fixed tick
+void controlTask(void* arg) {
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        controlStats.beginIteration();
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(CONTROL_TICK_MS));
+        controlStats.mark(STAGE_DELAY);
+
+        controlLink.serve(executePadCommand);
+        controlStats.mark(STAGE_COMMANDS);
+        leds.play(phasePattern(sequence.getPhase()));
+        leds.update();
+        controlStats.mark(STAGE_LEDS);
 
-    // You can add other non-blocking tasks here if needed.
-    // Avoid using long delays in the loop() as it will make the web server unresponsive.
-    delay(1); // A very small delay can sometimes be helpful for stability on some platforms
-    flash(COLOR_BLUE, 500);
+        sequence.update();
+        clamps.update();
+        controlStats.mark(STAGE_SEQUENCE);
 
-    igniter.update();
-}
\ No newline at end of file
+        pyros.update();
+        controlStats.mark(STAGE_PYRO);
+        sensors.update();
+        controlStats.mark(STAGE_SENSORS);
+        buzzer.update();
+        controlStats.mark(STAGE_BUZZER);
+
+        controlLink.publish(readPadState());
+        controlStats.mark(STAGE_EVENTS);
+    }
+}
+
+// Core 0: web server, WebSockets and event streams
+void networkTask(void* arg) {
+    for (;;) {
+        networkStats.beginIteration();
+        server.handleClient();
+        wsClients.poll(onWsMessage);
+        udpCommands.poll(commands);
+        networkStats.mark(STAGE_NETWORK);
+
+        static char frame[PAD_EVENTS_FRAME_SIZE];
+        PadState state = controlLink.state();
+        announce(state);
+        if (padEvents.poll(state, frame, sizeof(frame))) {
+            eventClients.broadcast(frame);
+        }
+        networkStats.mark(STAGE_EVENTS);
+
+        delay(1); // Lets the Wi-Fi stack and idle task run
+        networkStats.mark(STAGE_DELAY);
+    }
+}
+
+void loop() {
+    // Both cores run their own tasks, started at the end of setup()
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,82 @@
+// Host entry point for the native environment.
+//
+// Runs the RP2040 firmware (main_rp2040.cpp) on top of the mock HAL in
+// hal/native, so the control loop and HTTP path can be exercised and timed
+// without a board. Both cores' loops take turns on the one host thread.
+//
+// The sense inputs read a healthy pad (igniter in circuit, 12 V supply)
+// unless --adc-replay gives a recorded stream: CSV rows of raw 12-bit
+// "continuity,voltage" samples, one row per pair of sample slots.
+//
+// The web server listens on port 80 + --port-offset, UDP commands on
+// 4210 + --port-offset.
+//
+//   .pio/build/native/program [--port-offset N] [--seconds N] [--quiet] [--adc-replay FILE]
+
+#include <Arduino.h>
+#include <pins.h>
+
+void setup();
+void loop();
+void setup1();
+void loop1();
+
+// Loads a recorded sample stream into the mock ADC; false if the file is unreadable.
+bool loadAdcReplay(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) return false;
+    char line[64];
+    unsigned int continuity, voltage;
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "%u,%u", &continuity, &voltage) == 2) { // Skips a header row
+            NativeHAL::pin(PYRO_CONTINUITY_PIN)->samples.push_back(continuity);
+            NativeHAL::pin(PAD_VOLTAGE_PIN)->samples.push_back(voltage);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    unsigned long runSeconds = 0; // 0 = run until killed
+    NativeHAL::pin(PYRO_CONTINUITY_PIN)->analogIn = 60;      // ~50 mV: igniter in circuit
+    NativeHAL::pin(PAD_VOLTAGE_PIN)->analogIn = 1354;       // 12.0 V through the divider
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--port-offset") == 0 && i + 1 < argc) {
+            NativeHAL::portOffset = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            runSeconds = strtoul(argv[++i], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--quiet") == 0) {
+            NativeHAL::serialEcho = false;
+        }
+        else if (strcmp(argv[i], "--adc-replay") == 0 && i + 1 < argc) {
+            if (!loadAdcReplay(argv[++i])) {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else {
+            fprintf(stderr, "usage: %s [--port-offset N] [--seconds N] [--quiet] [--adc-replay FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    setup();
+    setup1();
+
+    unsigned long start = micros();
+    unsigned long iterations = 0;
+    while (runSeconds == 0 || micros() - start < runSeconds * 1000000UL) {
+        loop();
+        loop1();
+        iterations++;
+    }
+
+    unsigned long elapsed = micros() - start;
+    fprintf(stderr, "native: %lu loop iterations in %lu us (%.1f us/iteration)\n",
+        iterations, elapsed, iterations ? (double)elapsed / iterations : 0.0);
+    return 0;
+}
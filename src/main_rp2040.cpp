@@ -1,17 +1,48 @@
 #include <Arduino.h>
 #include <WiFiNINA.h> // For RP2040 Connect
+#include <WiFiUdp.h>
 
 // Include your custom libraries
 #include "clamps.h"
 #include "buzzer.h"
 #include "leds.h"
-#include "pyro.h"
-#include "html.h"       // Assumes index_html is defined here in PROGMEM
+#include "pyrobank.h"
+#include "html.h"       // Gzipped index_html_gz and its ETag, generated by build.py
 #include "rp2040webserver.h"  // Our C-string based web server
+#include "loopstats.h"
+#include "padstate.h"
+#include "padcommands.h"
+#include "launchsequence.h"
+#include "calibration.h"
+#include "controllink.h"
+#include "commandcore.h"
+#include "udpcommands.h"
+#include "eventlog.h"
+#include "padsensors.h"
+#if USE_RP2040
+#include "pico/multicore.h"
+#endif
+
+// Core 1 runs the pad (sequence, clamps, pyros) every CORE1_TICK_US; core 0
+// keeps WiFiNINA, the web server, LEDs and buzzer. Commands and settings
+// reach core 1 through `controlLink` and core 1 publishes a PadState
+// snapshot back; core 0 never writes core 1's state itself.
+#define CORE1_TICK_US 100
 
 // --- Global Objects ---
 Clamps clamps = Clamps();
-PyroChannel igniter = PyroChannel(PYRO_IGNITION_PIN, 2000);
+// Pyro schedule: { pin, delay ms, duration ms } per channel, from ignition.
+// Channels with the same delay switch together in one GPIO write; add
+// clustered or staged motors here.
+const PyroStep PYRO_SCHEDULE[] = {
+    { PYRO_IGNITION_PIN, 0, 2000 },  // Main motor igniter
+};
+PyroBank<sizeof(PYRO_SCHEDULE) / sizeof(PYRO_SCHEDULE[0])> pyros(PYRO_SCHEDULE);
+CalibrationStore calibrationStore;
+PadSensors sensors;
+LoopStats core0Stats;    // Network, LEDs, buzzer
+LoopStats core1Stats;    // The pad
+PadStateEvents padEvents;
 
 // --- Wi-Fi Access Point Configuration ---
 const char* ssid = "LaunchPad";     // The name of the Wi-Fi network to create
@@ -25,20 +56,543 @@ IPAddress apSubnet(255, 255, 255, 0); // Subnet mask
 // --- Web Server Instance ---
 SimpleWebServer server(80); // HTTP port
 
-// --- Control Functions ---
-void launch() {
-    Serial.println(F("Launch sequence initiated from web."));
-    clamps.openClamps(); // Open clamps
-    igniter.fire();      // Fire pyro
-    // Add any other launch sequence steps here
+// --- Cross-Core Link ---
+void loop1();
+
+// Runs while a route waits for core 1 to ack a command
+void waitForCore1() {
+#if USE_NATIVE
+    loop1(); // The host build has one core: run core 1's loop here
+#endif
+}
+
+ControlLink controlLink(waitForCore1);
+
+// --- Launch Sequence Steps ---
+// These run on core 1: no Serial, sounds or LEDs. Core 0 announces them
+// from the published state instead (see announce()).
+void ignite() {
+    pyros.fire();
+}
+
+void releaseClamps() {
+    clamps.openClamps();
+}
+
+void makeSafe() {
+    pyros.stop();
+    clamps.closeClamps();
+}
+
+bool clampsMoving() {
+    return clamps.isMoving();
+}
+
+// Pyros only arm, and the countdown only runs, with a valid continuity
+// reading
+bool igniterConnected() {
+    return sensors.hasContinuity();
+}
+
+LaunchSequence sequence({ ignite, releaseClamps, makeSafe, nullptr, clampsMoving, igniterConnected });
+
+// Starts the countdown from ARMED, or resumes it from HOLD, with the
+// igniter in circuit
+uint8_t launch() {
+    if (sequence.start()) {
+        return CMD_STATUS_OK;
+    }
+    LaunchPhase phase = sequence.getPhase();
+    return phase == PHASE_ARMED || phase == PHASE_HOLD ? CMD_STATUS_NO_CONTINUITY : CMD_STATUS_REJECTED;
+}
+
+// Back to ARMED for another attempt. The pyros are re-armed through the
+// continuity check, since the last igniter has usually burnt; without one
+// the pad is left SAFE and disarmed.
+uint8_t recycle() {
+    if (!sequence.recycle()) {
+        return CMD_STATUS_REJECTED;
+    }
+    if (!pyros.arm()) {
+        pyros.disarm();
+        sequence.disarm();
+        return CMD_STATUS_NO_CONTINUITY;
+    }
+    return CMD_STATUS_OK;
+}
+
+// Snapshot of everything the UI displays; built on core 1, pushed on /events by core 0
+PadState readPadState() {
+    PadState state;
+    state.armed = pyros.getArmed();
+    state.firing = pyros.getFiring();
+    Vec2D pos = clamps.getPos();
+    state.clamp1 = pos.x;
+    state.clamp2 = pos.y;
+    state.loopMaxMs = core1Stats.iteration.maxUs / 1000;
+    state.overruns = core1Stats.iteration.overruns;
+    state.phase = sequence.getPhase();
+    state.clockMs = sequence.getClock();
+    state.continuity = sensors.hasContinuity();
+    state.padMv = sensors.padMv();
+    return state;
+}
+
+// Runs one command on core 1 and builds its ack
+PadAckFrame executePadCommand(const PadCommandFrame& cmd) {
+    PadAckFrame ack = { cmd.command, cmd.seq, CMD_STATUS_OK, 0, 0, 0 };
+    switch (cmd.command) {
+        case CMD_PING:
+            break;
+        case CMD_LAUNCH:
+            ack.status = launch();
+            break;
+        case CMD_ABORT:
+            sequence.abort();
+            break;
+        case CMD_CLAMPS_OPEN:
+            clamps.openClamps();
+            break;
+        case CMD_CLAMPS_CLOSE:
+            clamps.closeClamps();
+            break;
+        case CMD_CLAMPS_NUDGE:
+            clamps.nudge(cmd.arg1, cmd.arg2);
+            break;
+        case CMD_HOLD:
+            ack.status = sequence.hold() ? CMD_STATUS_OK : CMD_STATUS_REJECTED;
+            break;
+        case CMD_RECYCLE:
+            ack.status = recycle();
+            break;
+        case CMD_ARM:
+            // Only while idle, and only with the igniter in circuit
+            if (sequence.getPhase() != PHASE_SAFE && sequence.getPhase() != PHASE_ARMED) {
+                ack.status = CMD_STATUS_REJECTED;
+            }
+            else if (!pyros.arm()) {
+                ack.status = CMD_STATUS_NO_CONTINUITY;
+            }
+            else {
+                sequence.arm();
+            }
+            break;
+        case CMD_DISARM:
+            // After an abort or a launch, via ARMED; a running sequence needs an abort first
+            if (sequence.getPhase() == PHASE_ABORT || sequence.getPhase() == PHASE_COMPLETE) {
+                sequence.recycle();
+            }
+            if (sequence.getPhase() != PHASE_SAFE && !sequence.disarm()) {
+                ack.status = CMD_STATUS_REJECTED;
+            }
+            else {
+                pyros.disarm();
+            }
+            break;
+        default:
+            ack.status = CMD_STATUS_UNKNOWN_COMMAND;
+            break;
+    }
+    Vec2D pos = clamps.getPos();
+    ack.clamp1 = pos.x;
+    ack.clamp2 = pos.y;
+    ack.flags = (pyros.getArmed() ? PAD_FLAG_ARMED : 0) | (pyros.getFiring() ? PAD_FLAG_FIRING : 0);
+    return ack;
+}
+
+// Core 0 feedback for a command core 1 has run
+void commandDone(const PadAckFrame& ack) {
+    if (ack.command == CMD_ABORT) {
+        Serial.println(F("ABORT sequence initiated from web."));
+        playAbortSound();
+    }
+}
+
+// Core 0 feedback for what the sequence did on core 1: log lines and sounds,
+// from each new snapshot
+void announce(const PadState& state) {
+    static PadState last;
+    // Floor of the clock in whole seconds; the countdown beeps as it changes
+    long second = state.clockMs >= 0 ? state.clockMs / 1000 : -((999 - state.clockMs) / 1000);
+    static long lastSecond = 0;
+
+    if (state.phase == PHASE_COUNTDOWN) {
+        if (last.phase == PHASE_ARMED ||
+            (last.phase == state.phase && second != lastSecond)) {
+            playCountdownTick();
+        }
+    }
+    if (state.firing && !last.firing) {
+        Serial.println(F("IGNITION"));
+        playIgnitionSound();
+    }
+    if (!state.firing && last.firing) {
+        Serial.print(F("Pyro burn complete, skew "));
+        Serial.print(pyros.getSkew());
+        Serial.print(" us, burn ");
+        Serial.print(pyros.getLastBurn(0));
+        Serial.println(" us");
+    }
+    if (state.phase == PHASE_CLAMP_RELEASE && last.phase != state.phase) {
+        Serial.println(F("CLAMP RELEASE"));
+    }
+    if (state.phase == PHASE_ABORT && last.phase != state.phase && !state.continuity) {
+        Serial.println(F("ABORT: igniter continuity lost."));
+        playAbortSound();
+    }
+    static uint32_t lastRefused = 0;
+    uint32_t refused = pyros.getRefused();
+    if (refused != lastRefused) {
+        Serial.println(F("ERROR: Pyro bank not armed!"));
+        lastRefused = refused;
+    }
+    last = state;
+    lastSecond = second;
+}
+
+// --- Core 1 jobs (see ControlLink::run) ---
+
+// /sequence: applies the values given, then reports
+struct SequenceJob {
+    bool setCountdown;
+    bool setRelease;
+    long countdownMs;
+    long releaseMs;
+    const char* phase;
+};
+
+bool sequenceJob(SequenceJob& job) {
+    bool ok = true;
+    if (job.setCountdown || job.setRelease) {
+        ok = sequence.configure(job.setCountdown ? job.countdownMs : sequence.getCountdown(),
+            job.setRelease ? job.releaseMs : sequence.getClampRelease());
+    }
+    job.countdownMs = sequence.getCountdown();
+    job.releaseMs = sequence.getClampRelease();
+    job.phase = sequence.getPhaseName();
+    return ok;
+}
+
+enum CalibrationChange : uint8_t {
+    CALIBRATION_READ,
+    CALIBRATION_PRESET_OPEN,    // Current position becomes the open preset
+    CALIBRATION_PRESET_CLOSE,
+    CALIBRATION_LIMITS
+};
+
+const int16_t CLAMP_LIMIT_KEEP = INT16_MIN;
+
+// /clamps/preset, /clamps/limits, /clamps/calibration. Changes are refused
+// while the sequence runs; `cal` comes back as the clamps now have it.
+struct CalibrationJob {
+    CalibrationChange change;
+    int16_t limits[4];          // min1, max1, min2, max2; CLAMP_LIMIT_KEEP leaves one as it is
+    ClampCalibration cal;
+};
+
+bool calibrationJob(CalibrationJob& job) {
+    ClampCalibration cal = clamps.getCalibration();
+    if (job.change != CALIBRATION_READ) {
+        if (sequence.isRunning()) {
+            return false;
+        }
+        Vec2D pos = clamps.getPos();
+        int16_t* limits[4] = { &cal.clamp1Min, &cal.clamp1Max, &cal.clamp2Min, &cal.clamp2Max };
+        switch (job.change) {
+            case CALIBRATION_PRESET_OPEN:
+                cal.clamp1Open = pos.x;
+                cal.clamp2Open = pos.y;
+                break;
+            case CALIBRATION_PRESET_CLOSE:
+                cal.clamp1Close = pos.x;
+                cal.clamp2Close = pos.y;
+                break;
+            default:
+                for (int i = 0; i < 4; i++) {
+                    if (job.limits[i] != CLAMP_LIMIT_KEEP) *limits[i] = job.limits[i];
+                }
+                break;
+        }
+        clamps.setCalibration(cal);
+    }
+    job.cal = clamps.getCalibration();
+    return true;
+}
+
+// /metrics?reset=1: core 1's own stats
+bool resetCore1Stats(int&) {
+    core1Stats.reset();
+    outputs.resetCounters();
+    return true;
+}
+
+// Command core transport: SimpleWebServer query args and replies
+bool queryArg(const char* name, char* value, size_t size) {
+    if (!server.hasArg(name)) {
+        return false;
+    }
+    snprintf(value, size, "%s", server.arg(name));
+    return true;
+}
+
+void sendReply(int code, const char* text) {
+    server.send(code, "text/plain", text);
+}
+
+CommandCore commands(controlLink, { queryArg, sendReply }, commandDone);
+UdpCommandServer<WiFiUDP> udpCommands;  // Datagram commands, see udpcommands.h
+
+// Route handler for COMMAND_ROUTES[route]
+template <int route>
+void serveCommand() {
+    commands.serve(route, server.requestMicros());
+}
+
+void onWsMessage(const uint8_t* data, size_t len) {
+    PadCommandFrame cmd;
+    PadAckFrame ack = { 0, 0, CMD_STATUS_BAD_FRAME, 0, 0, 0 };
+    if (cmd.decode(data, len)) {
+        commands.call(cmd, ack, server.requestMicros());
+    }
+    uint8_t reply[PAD_ACK_FRAME_SIZE];
+    server.sendWebSocket(reply, ack.encode(reply));
+}
+
+// Replies 409 or 503 for a job core 1 refused or did not run
+bool jobFailed(uint8_t status) {
+    if (status == CMD_STATUS_OK) {
+        return false;
+    }
+    server.send(status == CMD_STATUS_REJECTED ? 409 : 503, "text/plain",
+        status == CMD_STATUS_REJECTED ? "Sequence running." : "Control loop busy.");
+    return true;
+}
+
+// Runs `job` on core 1 and replies with the clamp calibration, saving it
+// first if the job changed it (flash is only written when it differs from
+// what is stored)
+void serveCalibration(CalibrationJob& job) {
+    if (jobFailed(controlLink.run<CalibrationJob, calibrationJob>(job))) {
+        return;
+    }
+    if (job.change != CALIBRATION_READ && !calibrationStore.save(job.cal)) {
+        server.send(500, "text/plain", "Calibration not saved.");
+        return;
+    }
+    char response[CALIBRATION_FORMAT_SIZE];
+    calibrationStore.format(job.cal, response, sizeof(response));
+    server.send(200, "text/plain", response);
+}
+
+// --- Web Server Routes (Endpoints) ---
+// Laid out at compile time in a perfect-hash table (see RouteTable in rp2040webserver.h).
+constexpr Route ROUTES[] = {
+    // Serve the main HTML UI from PROGMEM, gzipped. Browsers revalidate with
+    // If-None-Match and get an empty 304 while the page is unchanged.
+    { "/", HTTP_GET, []() {
+        Serial.println(F("Serving main page /"));
+        server.sendHeader("ETag", index_html_etag);
+        server.sendHeader("Cache-Control", "no-cache");
+        if (strstr(server.header("If-None-Match"), index_html_etag)) {
+            server.send(304, "text/html", "");
+            return;
+        }
+        server.sendHeader("Content-Encoding", "gzip");
+        server.send_P(200, "text/html", (const char*)index_html_gz, index_html_gz_len);
+        } },
+
+    // Pad commands, served by the command core (see commandcore.h)
+    { COMMAND_ROUTES[ROUTE_LAUNCH].path, HTTP_GET, serveCommand<ROUTE_LAUNCH> },
+    { COMMAND_ROUTES[ROUTE_HOLD].path, HTTP_GET, serveCommand<ROUTE_HOLD> },
+    { COMMAND_ROUTES[ROUTE_RECYCLE].path, HTTP_GET, serveCommand<ROUTE_RECYCLE> },
+    { COMMAND_ROUTES[ROUTE_ARM].path, HTTP_GET, serveCommand<ROUTE_ARM> },
+    { COMMAND_ROUTES[ROUTE_DISARM].path, HTTP_GET, serveCommand<ROUTE_DISARM> },
+    { COMMAND_ROUTES[ROUTE_ABORT].path, HTTP_GET, serveCommand<ROUTE_ABORT> },
+    { COMMAND_ROUTES[ROUTE_CLAMPS_OPEN].path, HTTP_GET, serveCommand<ROUTE_CLAMPS_OPEN> },
+    { COMMAND_ROUTES[ROUTE_CLAMPS_CLOSE].path, HTTP_GET, serveCommand<ROUTE_CLAMPS_CLOSE> },
+    { COMMAND_ROUTES[ROUTE_CLAMPS_NUDGE].path, HTTP_GET, serveCommand<ROUTE_CLAMPS_NUDGE> },
+
+    // Handle /clamps/preset?name=open|close: store the current position as that preset
+    { "/clamps/preset", HTTP_GET, []() {
+        CalibrationJob job = {};
+        const char* name = server.arg("name");
+        if (strcmp(name, "open") == 0) {
+            job.change = CALIBRATION_PRESET_OPEN;
+        }
+        else if (strcmp(name, "close") == 0) {
+            job.change = CALIBRATION_PRESET_CLOSE;
+        }
+        else {
+            server.send(400, "text/plain", "name must be open or close.");
+            return;
+        }
+        serveCalibration(job);
+        } },
+
+    // Handle /clamps/limits?min1=&max1=&min2=&max2=: soft travel limits (degrees)
+    { "/clamps/limits", HTTP_GET, []() {
+        static const char* const names[4] = { "min1", "max1", "min2", "max2" };
+        CalibrationJob job = {};
+        job.change = CALIBRATION_LIMITS;
+        for (int i = 0; i < 4; i++) {
+            job.limits[i] = server.hasArg(names[i]) ? atoi(server.arg(names[i])) : CLAMP_LIMIT_KEEP;
+        }
+        serveCalibration(job);
+        } },
+
+    // Handle /clamps/calibration: report presets, limits and flash saves
+    { "/clamps/calibration", HTTP_GET, []() {
+        CalibrationJob job = {};
+        serveCalibration(job);
+        } },
+
+    // Handle /sequence: countdown and clamp release offset (ms, relative to
+    // ignition), e.g. /sequence?countdown=10000&release=500. No args just reports.
+    { "/sequence", HTTP_GET, []() {
+        SequenceJob job = {};
+        job.setCountdown = server.hasArg("countdown");
+        job.setRelease = server.hasArg("release");
+        job.countdownMs = atol(server.arg("countdown"));
+        job.releaseMs = atol(server.arg("release"));
+        if (jobFailed(controlLink.run<SequenceJob, sequenceJob>(job))) {
+            return;
+        }
+        char response[96];
+        snprintf(response, sizeof(response), "phase=%s countdown=%ld release=%ld\n",
+            job.phase, job.countdownMs, job.releaseMs);
+        server.send(200, "text/plain", response);
+        } },
+
+    // Handle /events: Server-Sent Event stream of pad state
+    { "/events", HTTP_GET, []() {
+        if (server.beginEventStream()) {
+            padEvents.invalidate(); // Send the current state straight away
+        }
+        } },
+
+    // Handle /ws: WebSocket control channel (binary frames, see padcommands.h)
+    { "/ws", HTTP_GET, []() {
+        server.beginWebSocket();
+        } },
+
+    // Handle /log: the event log, oldest first, as CSV or as 8-byte binary
+    // records (?format=bin); ?consume=1 leaves the sent records out of later dumps
+    { "/log", HTTP_GET, []() {
+        static char chunk[SWS_SEND_CHUNK_SIZE];
+        EventLogReader reader(eventLog);
+        bool binary = strcmp(server.arg("format"), "bin") == 0;
+        server.beginContent(200, binary ? "application/octet-stream" : "text/csv");
+        size_t len;
+        while ((len = binary ? reader.readBinary((uint8_t*)chunk, sizeof(chunk)) : reader.readCsv(chunk, sizeof(chunk))) > 0) {
+            server.sendContent(chunk, len);
+        }
+        if (server.hasArg("consume")) {
+            reader.consume();
+        }
+        } },
+
+    // Handle /metrics: loop and stage timing histograms per core (?reset=1 clears them)
+    { "/metrics", HTTP_GET, []() {
+        static char metrics[LOOPSTATS_FORMAT_BUFFER_SIZE];
+        size_t len = core0Stats.format(metrics, sizeof(metrics), "core0");
+        len += core1Stats.format(metrics + len, sizeof(metrics) - len, "core1");
+        const SimpleWebServer::ResponseStats& http = server.responseStats();
+        snprintf(metrics + len, sizeof(metrics) - len,
+            "http responses=%lu bytes=%lu writes=%lu last_bytes=%lu last_writes=%lu last_us=%lu\n",
+            (unsigned long)http.responses, (unsigned long)http.bytes, (unsigned long)http.writeCalls,
+            (unsigned long)http.lastBytes, (unsigned long)http.lastWriteCalls, (unsigned long)http.lastMicros);
+        len += strlen(metrics + len);
+        snprintf(metrics + len, sizeof(metrics) - len,
+            "sequence phase=%s t=%ld ticks=%lu late_max_ms=%lu\n",
+            sequence.getPhaseName(), sequence.getClock(), sequence.getTicks(), sequence.getMaxLateness());
+        len += strlen(metrics + len);
+        len += controlLink.format(metrics + len, sizeof(metrics) - len);
+        len += commands.format(metrics + len, sizeof(metrics) - len);
+        snprintf(metrics + len, sizeof(metrics) - len, "eventlog core0=%lu core1=%lu size=%d\n",
+            (unsigned long)eventLog.count(0), (unsigned long)eventLog.count(1), EVENT_LOG_SIZE);
+        len += strlen(metrics + len);
+        len += pyros.format(metrics + len, sizeof(metrics) - len, "bank");
+        len += sensors.format(metrics + len, sizeof(metrics) - len);
+        len += leds.format(metrics + len, sizeof(metrics) - len);
+        len += udpCommands.format(metrics + len, sizeof(metrics) - len);
+        outputs.format(metrics + len, sizeof(metrics) - len);
+        if (server.hasArg("reset")) {
+            int none = 0;
+            controlLink.run<int, resetCore1Stats>(none);
+            controlLink.resetStats();
+            commands.resetStats();
+            udpCommands.resetStats();
+            core0Stats.reset();
+            outputs.resetCounters(); // This core's writes; the job cleared the other's
+        }
+        server.send(200, "text/plain", metrics);
+        } },
+};
+constexpr RouteTable ROUTE_TABLE(ROUTES);
+static_assert(ROUTE_TABLE.valid(), "Route paths must be unique");
+
+// Every command route is served, each by its own handler
+template <size_t N>
+constexpr bool commandRoutesServed(const Route (&routes)[N]) {
+    for (int i = 0; i < COMMAND_ROUTE_COUNT; i++) {
+        bool found = false;
+        for (size_t j = 0; j < N; j++) {
+            found = found || (routes[j].path == COMMAND_ROUTES[i].path);
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+static_assert(commandRoutesServed(ROUTES), "A command route is missing from ROUTES");
+
+// --- Core 1 ---
+// setup1()/loop1() after the Earle Philhower core's convention. The mbed core
+// has no such hooks, so setup() starts core 1 on core1Main() itself; the
+// native build calls them from main().
+void setup1() {
+    pyros.begin(); // Claims the pyro timer alarm, so it interrupts this core
+    pyros.setArmCheck(igniterConnected);
+    sensors.begin();
+    // Stays SAFE until /arm: arming needs a settled continuity reading
+}
+
+// One pad tick every CORE1_TICK_US; returns straight away between ticks.
+void loop1() {
+    static unsigned long nextTick = micros();
+    unsigned long now = micros();
+    if ((long)(now - nextTick) < 0) {
+        return;
+    }
+    nextTick += CORE1_TICK_US;
+    if ((long)(now - nextTick) >= 0) {
+        nextTick = now + CORE1_TICK_US; // Fell behind; don't run a burst of ticks
+    }
+
+    core1Stats.beginIteration();
+    controlLink.serve(executePadCommand);
+    core1Stats.mark(STAGE_COMMANDS);
+
+    sequence.update();
+    clamps.update();
+    core1Stats.mark(STAGE_SEQUENCE);
+    pyros.update();
+    core1Stats.mark(STAGE_PYRO);
+    sensors.update();
+    core1Stats.mark(STAGE_SENSORS);
+
+    controlLink.publish(readPadState());
+    core1Stats.mark(STAGE_EVENTS);
 }
 
-void abortLaunch() {
-    Serial.println(F("ABORT sequence initiated from web."));
-    clamps.closeClamps(); // Close clamps
-    igniter.stop();       // Stop pyro
-    // Add any other abort sequence steps here
+#if USE_RP2040
+void core1Main() {
+    multicore_lockout_victim_init(); // Parked in RAM while core 0 writes flash
+    setup1();
+    while (true) {
+        loop1();
+    }
 }
+#endif
 
 // --- Arduino Setup ---
 void setup() {
@@ -47,6 +601,14 @@ void setup() {
 
     Serial.println(F("\nLaunch Control System Initializing..."));
 
+    ClampCalibration calibration = clamps.getCalibration();
+    if (calibrationStore.begin(calibration)) {
+        clamps.setCalibration(calibration);
+        Serial.print(F("Clamp calibration restored in "));
+        Serial.print(calibrationStore.loadMicros);
+        Serial.println(F(" us."));
+    }
+
     // Start the AP first (without IP config)
     Serial.print(F("Starting Access Point: "));
     Serial.println(ssid);
@@ -59,49 +621,19 @@ void setup() {
     }
     else {
         Serial.println(F("Failed to start Access Point!"));
+        leds.play(PATTERN_FAULT);
         while (1) {
-            flash(COLOR_RED, 500);
+            leds.update();
         }
     }
 
-    // --- Define Web Server Routes (Endpoints) ---
-
-    // Serve the main HTML UI from PROGMEM
-    server.on("/", HTTP_GET, []() {
-        Serial.println(F("Serving main page /"));
-        server.send_P(200, "text/html", index_html);
-        });
-
-    // Handle /launch command
-    server.on("/launch", HTTP_GET, []() {
-        Serial.println(F("Received /launch command"));
-        launch();
-        server.send(200, "text/plain", "Launch sequence triggered.");
-        });
-
-    // Handle /abort command
-    server.on("/abort", HTTP_GET, []() {
-        Serial.println(F("Received /abort command"));
-        abortLaunch();
-        server.send(200, "text/plain", "Abort sequence triggered.");
-        });
-
-    // Handle /clamps/open command
-    server.on("/clamps/open", HTTP_GET, []() {
-        Serial.println(F("Received /clamps/open command"));
-        clamps.openClamps();
-        server.send(200, "text/plain", "Clamps opened.");
-        });
-
-    // Handle /clamps/close command
-    server.on("/clamps/close", HTTP_GET, []() {
-        Serial.println(F("Received /clamps/close command"));
-        clamps.closeClamps();
-        server.send(200, "text/plain", "Clamps closed.");
-        });
-
     // --- Start the Web Server ---
+    server.setRoutes(ROUTE_TABLE);
+    server.onWebSocketMessage(onWsMessage);
+    const char* headerKeys[] = { "If-None-Match" };
+    server.collectHeaders(headerKeys, 1);
     server.begin();
+    udpCommands.begin();
     Serial.println(F("Web server started."));
     Serial.print(F("Connect to Wi-Fi '"));
     Serial.print(ssid);
@@ -109,15 +641,24 @@ void setup() {
     Serial.print(WiFi.localIP());
     Serial.println(F("/"));
 
-    igniter.begin();
-    igniter.arm();
-
-    pinMode(LED_BUILTIN, OUTPUT);
-    digitalWrite(LED_BUILTIN, LOW);
+    pinMode(STATUS_LED_PIN, OUTPUT);
+    digitalWrite(STATUS_LED_PIN, LOW);
     pinMode(BUZZER_PIN, OUTPUT);
     pinMode(LEDR, OUTPUT);
     pinMode(LEDG, OUTPUT);
     pinMode(LEDB, OUTPUT);
+
+    playStartupSound();
+
+    if (pyros.unmaskedPin() >= 0) {
+        Serial.print(F("WARNING: Pyro pin not mask-writable, using digitalWrite: "));
+        Serial.println(pyros.unmaskedPin());
+    }
+
+    controlLink.publish(readPadState());
+#if USE_RP2040
+    multicore_launch_core1(core1Main);
+#endif
 }
 
 // --- Global Variables ---
@@ -125,8 +666,11 @@ int status = WL_IDLE_STATUS;
 
 // --- Arduino Loop ---
 void loop() {
+    core0Stats.beginIteration();
+
     // This is crucial: it allows the server to process incoming client requests.
     server.handleClient();
+    udpCommands.poll(commands);
 
     // compare the previous status to the current status
     if (status != WiFi.status()) {
@@ -141,11 +685,23 @@ void loop() {
             Serial.println("Device disconnected from AP");
         }
     }
+    core0Stats.mark(STAGE_NETWORK);
 
     // You can add other non-blocking tasks here if needed.
     // Avoid using long delays in the loop() as it will make the web server unresponsive.
     delay(1); // A very small delay can sometimes be helpful for stability on some platforms
-    flash(COLOR_BLUE, 500);
+    core0Stats.mark(STAGE_DELAY);
+    PadState state = controlLink.state();
+    leds.play(phasePattern(state.phase));
+    leds.update();
+    core0Stats.mark(STAGE_LEDS);
+    buzzer.update();
+    core0Stats.mark(STAGE_BUZZER);
 
-    igniter.update();
+    static char frame[PAD_EVENTS_FRAME_SIZE];
+    announce(state);
+    if (padEvents.poll(state, frame, sizeof(frame))) {
+        server.sendEvent(frame);
+    }
+    core0Stats.mark(STAGE_EVENTS);
 }